@@ -3,14 +3,14 @@
 // basic instructions
 
 #define NOP                     0x00
-#define LD_BC_imm16(IMM)        0x01, (IMM & 0xff), (IMM >> 8)
+#define LD_BC_imm16(IMM)        0x01, static_cast<uint8_t>((IMM) & 0xff), static_cast<uint8_t>((IMM) >> 8)
 #define LD_ptrBC_A              0x02
 #define INC_BC                  0x03
 #define INC_B                   0x04
 #define DEC_B                   0x05
 #define LD_B_imm8(IMM)          0x06, IMM
 #define RLCA                    0x07
-#define LD_ptr_SP(PTR)          0x08, (PTR & 0xff), (PTR >> 8)
+#define LD_ptr_SP(PTR)          0x08, static_cast<uint8_t>((PTR) & 0xff), static_cast<uint8_t>((PTR) >> 8)
 #define ADD_HL_BC               0x09
 #define LD_A_ptrBC              0x0a
 #define DEC_BC                  0x0b
@@ -19,7 +19,7 @@
 #define LD_C_imm8(IMM)          0x0e, IMM 
 #define RRCA                    0x0f
 #define STOP(X)                 0x10, X
-#define LD_DE_imm16(IMM)        0x11, (IMM & 0xff), (IMM >> 8)
+#define LD_DE_imm16(IMM)        0x11, static_cast<uint8_t>((IMM) & 0xff), static_cast<uint8_t>((IMM) >> 8)
 #define LD_ptrDE_A              0x12
 #define INC_DE                  0x13
 #define INC_D                   0x14
@@ -35,7 +35,7 @@
 #define LD_E_imm8(IMM)          0x1e, IMM
 #define RRA                     0x1f
 #define JR_NZ(REL)              0x20, static_cast<uint8_t>(REL)
-#define LD_HL_imm16(IMM)        0x21, (IMM & 0xff), (IMM >> 8)
+#define LD_HL_imm16(IMM)        0x21, static_cast<uint8_t>((IMM) & 0xff), static_cast<uint8_t>((IMM) >> 8)
 #define LD_incHL_A              0x22
 #define INC_HL                  0x23
 #define INC_H                   0x24
@@ -51,7 +51,7 @@
 #define LD_L_imm8(IMM)          0x2e, IMM
 #define CPL                     0x2f
 #define JR_NC(REL)              0x30, static_cast<uint8_t>(REL)
-#define LD_SP_imm16(IMM)        0x31, (IMM & 0xff), (IMM >> 8)
+#define LD_SP_imm16(IMM)        0x31, static_cast<uint8_t>((IMM) & 0xff), static_cast<uint8_t>((IMM) >> 8)
 #define LD_decHL_A              0x32
 #define INC_SP                  0x33
 #define INC_ptrHL               0x34
@@ -196,33 +196,33 @@
 #define CP_A_A                  0xbf
 #define RET_NZ                  0xc0
 #define POP_BC                  0xc1
-#define JP_NZ(ABS)              0xc2, (ABS & 0xff), (ABS >> 8)
-#define JP(ABS)                 0xc3, (ABS & 0xff), (ABS >> 8)
-#define CALL_NZ(ABS)            0xc4, (ABS & 0xff), (ABS >> 8)
+#define JP_NZ(ABS)              0xc2, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
+#define JP(ABS)                 0xc3, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
+#define CALL_NZ(ABS)            0xc4, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 #define PUSH_BC                 0xc5
 #define ADD_A_imm8(IMM)         0xc6, IMM
 #define RST_00                  0xc7
 #define RET_Z                   0xc8
 #define RET                     0xc9
-#define JP_Z(ABS)               0xca, (ABS & 0xff), (ABS >> 8)
+#define JP_Z(ABS)               0xca, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 // prefix 0xcb
-#define CALL_Z(ABS)             0xcc, (ABS & 0xff), (ABS >> 8)
-#define CALL(ABS)               0xcd, (ABS & 0xff), (ABS >> 8)
+#define CALL_Z(ABS)             0xcc, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
+#define CALL(ABS)               0xcd, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 #define ADC_A_imm8(IMM)         0xce, IMM
 #define RST_08                  0xcf
 #define RET_NC                  0xd0
 #define POP_DE                  0xd1
-#define JP_NC(ABS)              0xd2, (ABS & 0xff), (ABS >> 8)       
+#define JP_NC(ABS)              0xd2, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)       
 // 0xd3 not used
-#define CALL_NC(ABS)            0xd4, (ABS & 0xff), (ABS >> 8)
+#define CALL_NC(ABS)            0xd4, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 #define PUSH_DE                 0xd5
 #define SUB_A_imm8(IMM)         0xd6, IMM
 #define RST_10                  0xd7
 #define RET_C                   0xd8
 #define RETI                    0xd9
-#define JP_C(ABS)               0xda, (ABS & 0xff), (ABS >> 8)
+#define JP_C(ABS)               0xda, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 // 0xdb not used
-#define CALL_C(ABS)             0xdc, (ABS & 0xff), (ABS >> 8)
+#define CALL_C(ABS)             0xdc, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 // 0xdd not used
 #define SBC_A_imm8(IMM)         0xde, IMM
 #define RST_18                  0xdf
@@ -236,7 +236,7 @@
 #define RST_20                  0xe7
 #define ADD_SP_imm8(IMM)        0xe8, static_cast<uint8_t>(IMM)   
 #define JP_HL                   0xe9
-#define LD_ptr16_A(ABS)         0xea, (ABS & 0xff), (ABS >> 8)
+#define LD_ptr16_A(ABS)         0xea, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 // 0xeb not used
 // 0xec not used
 // 0xed not used
@@ -252,11 +252,11 @@
 #define RST_30                  0xf7
 #define LD_HL_SP_imm8(IMM)      0xf8, IMM
 #define LD_SP_HL                0xf9
-#define LD_A_ptr16(ABS)         0xfa, (ABS & 0xff), (ABS >> 8)
+#define LD_A_ptr16(ABS)         0xfa, static_cast<uint8_t>((ABS) & 0xff), static_cast<uint8_t>((ABS) >> 8)
 #define EI                      0xfb
 // 0xfc not used
 // 0xfd not used
-#define CP_A_imm8(ABS)          0xfe
+#define CP_A_imm8(IMM)          0xfe, IMM
 #define RST_38                  0xff
 
 // extended instructions
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "gbc.h"
 
 #define IO_JOYP (state_.highMem_[ADDR_IO_JOYP])
@@ -80,6 +82,10 @@ uint8_t GBC::read8(uint16_t address) {
                     return JOYP_DPAD | (btnDown(Btn::Down) ? 0 : 8) | (btnDown(Btn::Up) ? 0 : 4) | (btnDown(Btn::Left) ? 0 : 2) | (btnDown(Btn::Right) ? 0 : 1);
                 else 
                    return JOYP_BUTTONS | (btnDown(Btn::Start) ? 0 : 8) | (btnDown(Btn::Select) ? 0 : 4) | (btnDown(Btn::B) ? 0 : 2) | (btnDown(Btn::A) ? 0 : 1);
+            case ADDR_IO_BCPD_BGPD:
+                return state_.bgPaletteRam_[IO_BCPS_BGPI & 0x3f];
+            case ADDR_IO_OCPD_OBPD:
+                return state_.objPaletteRam_[IO_OCPS_OCPI & 0x3f];
                     
             default:
                 return state_.highMem_[address & 0xff];
@@ -97,10 +103,19 @@ uint16_t GBC::read16(uint16_t address) {
 void GBC::write8(uint16_t address, uint8_t value) {
     // TODO order according to the most likely outcomes
     if (address < 0x8000) { // rom
-        // do nothing 
-        // TODO this actually changes the rom bank & eram bank via cartridge mapper
+        // ROM bank select of the MBC1 mapper, ROMs of two banks or less have no mapper
+        // TODO the eram bank and other cartridge mappers
+        if (address >= 0x2000 && address < 0x4000 && state_.romSize_ > 2 * State::ROM_BANK_SIZE) {
+            size_t banks = (state_.romSize_ + State::ROM_BANK_SIZE - 1) / State::ROM_BANK_SIZE;
+            size_t bank = value & 0x1f;
+            state_.setROMBank((bank == 0 ? 1 : bank) % banks);
+        }
+        // the rest of the block being executed might be from the old bank, the cached blocks are keyed by the bank and stay valid
+        blockOpsLeft_ = 0;
     } else if (address >= 0x8000 && address < 0xa000) { // vram
         state_.memMap_[address >> 12][address & 0xfff] = value;
+        if (address < ADDR_TILE_DATA_END)
+            tileValid_[(IO_WBK & 1) * TILES_PER_BANK + ((address - 0x8000) >> 4)] = false;
     } else if (address >= 0xa000 && address < 0xc000) { // eram
         UNIMPLEMENTED; 
     } else if (address < 0xfe00) { // wram & echo ram
@@ -115,9 +130,35 @@ void GBC::write8(uint16_t address, uint8_t value) {
                 IO_JOYP = value;
                 break;
             case ADDR_IO_STAT:
-                 IO_STAT &= STAT_WRITE_MASK;
+                 IO_STAT &= ~STAT_WRITE_MASK;
                  IO_STAT |= value & STAT_WRITE_MASK;
                  break;
+            case ADDR_IO_LCDC:
+                if ((IO_LCDC ^ value) & LCDC_ENABLE) {
+                    // turning the LCD off resets the PPU to the first line, turning it on starts the first line 
+                    state_.rendererDots_ = 0;
+                    state_.windowLine_ = 0;
+                    IO_LY = 0;
+                    IO_STAT &= ~STAT_PPU_MODE;
+                    if (value & LCDC_ENABLE)
+                        setMode(2);
+                    // the cycles the LCD was off are not counted towards the new first line and the PPU runs right after this instruction, which must therefore end the block being executed
+                    ppuCycles_ = cycles_;
+                    ppuEventDots_ = 0;
+                    blockOpsLeft_ = 0;
+                }
+                IO_LCDC = value;
+                break;
+            case ADDR_IO_WBK:
+                IO_WBK = value & 1;
+                state_.setVideoRAMBank(value & 1);
+                break;
+            case ADDR_IO_BCPD_BGPD:
+                writePalette(ADDR_IO_BCPS_BGPI, state_.bgPaletteRam_, bgPalette_, value);
+                break;
+            case ADDR_IO_OCPD_OBPD:
+                writePalette(ADDR_IO_OCPS_OCPI, state_.objPaletteRam_, objPalette_, value);
+                break;
             case ADDR_IO_LY: 
             case ADDR_IO_PCM12:
             case ADDR_IO_PCM34:
@@ -156,126 +197,173 @@ uint16_t GBC::rd16(uint16_t & address) {
 
 // arithmetics
 
+/** The arithmetic helpers only store the values the flags are computed from, see State::flagZ(). The flags set to constants are stored by the INS macro. 
+ */
 uint8_t GBC:: inc8(uint8_t x) {
-    ++x;
-    state_.setFlagZ(x == 0);
-    state_.setFlagH((x & 0xf) == 0);
-    return x;
+    uint8_t r = x + 1;
+    state_.setFlagZFrom(r);
+    state_.setFlagHFrom(x, 1, r);
+    return r;
 }
 
 uint8_t GBC:: dec8(uint8_t x) {
-    --x;
-    state_.setFlagZ(x == 0);
-    state_.setFlagH((x & 0xf) == 0xf);
-    return x;
+    uint8_t r = x - 1;
+    state_.setFlagZFrom(r);
+    state_.setFlagHFrom(x, 1, r);
+    return r;
 }
 
 /** Adds two 8bit numbers, optinally including a carry flag and sets the Z, H and C flags accordingly. 
 
-    The Z flag is set if the 8bit result is 0. The C flag is set if the result is greater than 256. Finally, the H flag is set if during 
+    The Z flag is set if the 8bit result is 0. The C flag is set if the result is greater than 255. Finally, the H flag is set if there is a carry from bit 3 to bit 4. 
 */
 uint8_t GBC:: add8(uint8_t a, uint8_t b, uint8_t c) {
     unsigned r = a + b + c;
-    state_.setFlagZ((r & 0xff) == 0);
-    state_.setFlagH(((a ^ b ^ r) & 0x10) != 0);
-    state_.setFlagC(r > 0xff);
+    state_.setFlagZFrom(static_cast<uint8_t>(r));
+    state_.setFlagHFrom(a, b, r);
+    state_.setFlagCFrom(r);
     return static_cast<uint8_t>(r);
 }
 
+/** Subtracts two 8bit numbers, optionally including a carry flag. When the result is negative, its bit 8 is set, which is the borrow, i.e. the C flag. 
+ */
 uint8_t GBC:: sub8(uint8_t a, uint8_t b, uint8_t c) {
     unsigned r = a - (b + c);
-    state_.setFlagZ((r & 0xff) == 0);
-    state_.setFlagH(((a ^ b ^ r) & 0x10) != 0);
-    state_.setFlagC(r > 0xff);
+    state_.setFlagZFrom(static_cast<uint8_t>(r));
+    state_.setFlagHFrom(a, b, r);
+    state_.setFlagCFrom(r);
     return static_cast<uint8_t>(r);
 }
 
 uint16_t GBC:: add16(uint16_t a, uint16_t b) {
     uint32_t r = a + b;
-    state_.setFlagC(r > 0xffff);
-    state_.setFlagH(((r ^ a ^ b) & 0x1000) != 0);
+    state_.setFlagCFrom(r >> 8);
+    state_.setFlagHFrom(a >> 8, b >> 8, r >> 8);
     return static_cast<uint16_t>(r);
 }
 
-/** Rotate left, set carry
+/** Rotate left, set carry. The rotations and shifts set the Z flag from the result, which the non-prefixed A register versions override to 0. 
  */
 uint8_t GBC:: rlc8(uint8_t a) {
-    uint16_t r = a << 1;
-    state_.setFlagC(r & 256);
-    r = r | state().flagC();
-    return (r & 0xff);
+    state_.setFlagCFrom(a << 1);
+    return state_.setFlagZFrom(static_cast<uint8_t>((a << 1) | (a >> 7)));
 }
 
 /** Rotate left through carry. 
  */
 uint8_t GBC:: rl8(uint8_t a) {
-    uint16_t r = a << 1;
-    r = r | state().flagC();
-    state_.setFlagC(r & 256);
-    return (r & 0xff);
+    unsigned r = (a << 1) | state().flagC();
+    state_.setFlagCFrom(r);
+    return state_.setFlagZFrom(static_cast<uint8_t>(r));
 }
 
 /** Rotate right, set carry. 
  */
 uint8_t GBC:: rrc8(uint8_t a) {
-    state_.setFlagC(a & 1);
-    a = a >> 1;
-    a = a | (state().flagC() ? 128 : 0);
-    return a;
+    state_.setFlagCFrom(a << 8);
+    return state_.setFlagZFrom(static_cast<uint8_t>((a >> 1) | (a << 7)));
 }
 
 /** Rotate right, through carry. 
  */
 uint8_t GBC:: rr8(uint8_t a) {
     bool cf = state().flagC();
-    state_.setFlagC(a & 1);
-    a = a >> 1;
-    a = a | (cf ? 128 : 0);
-    return a;
+    state_.setFlagCFrom(a << 8);
+    return state_.setFlagZFrom(static_cast<uint8_t>((a >> 1) | (cf ? 128 : 0)));
 }
 
 /** Shift left, overflow to carry.
  */
 uint8_t GBC:: sla8(uint8_t a) {
-    uint16_t r = a * 2;
-    state_.setFlagC(r & 256);
-    return r & 0xff;
+    state_.setFlagCFrom(a << 1);
+    return state_.setFlagZFrom(static_cast<uint8_t>(a << 1));
 }
 
 /** Shift right, arithmetically, i.e. keep msb intact*/
 uint8_t GBC:: sra8(uint8_t a) {
-    state_.setFlagC(a & 1);
-    a = a >> 1;
-    a |= (a & 64) ? 128 : 0;
-    return a;
+    state_.setFlagCFrom(a << 8);
+    return state_.setFlagZFrom(static_cast<uint8_t>((a >> 1) | (a & 128)));
 }
 
 /** Shift right, logically, i.e.msb set to 0. 
  */
 uint8_t GBC:: srl8(uint8_t a) {
-    state_.setFlagC(a & 1);
-    a = a >> 1;
-    return a;
+    state_.setFlagCFrom(a << 8);
+    return state_.setFlagZFrom(a >> 1);
+}
+
+/** Swaps the nibbles. 
+ */
+uint8_t GBC:: swap8(uint8_t a) {
+    return state_.setFlagZFrom(static_cast<uint8_t>((a << 4) | (a >> 4)));
 }
 
 // rendering 
 
+void GBC::resetPPU() {
+    for (size_t i = 0; i < 32; ++i) {
+        bgPalette_[i] = paletteColor(state_.bgPaletteRam_, i);
+        objPalette_[i] = paletteColor(state_.objPaletteRam_, i);
+    }
+    if (tileCache_ == nullptr)
+        tileCache_ = new uint8_t[TILE_CACHE_TILES * 64];
+    invalidateTiles();
+    ppuEventDots_ = 0;
+    frameDone_ = false;
+}
+
+rckid::ColorRGB GBC::paletteColor(uint8_t const * ram, size_t index) {
+    unsigned c = ram[index * 2] | (ram[index * 2 + 1] << 8);
+    unsigned r = c & 0x1f;
+    unsigned g = (c >> 5) & 0x1f;
+    unsigned b = (c >> 10) & 0x1f;
+    return rckid::ColorRGB::fromRaw(static_cast<uint16_t>((r << 11) | (((g << 1) | (g >> 4)) << 5) | b));
+}
+
+void GBC::decodeTile(size_t tile) {
+    uint8_t const * src = state_.vram_ + (tile / TILES_PER_BANK) * State::VRAM_BANK_SIZE + (tile % TILES_PER_BANK) * 16;
+    uint8_t * dst = tileCache_ + tile * 64;
+    for (unsigned row = 0; row < 8; ++row, src += 2) {
+        unsigned lo = src[0];
+        unsigned hi = src[1];
+        for (unsigned bit = 8; bit > 0; --bit)
+            *dst++ = static_cast<uint8_t>(((lo >> (bit - 1)) & 1) | (((hi >> (bit - 1)) & 1) << 1));
+    }
+    tileValid_[tile] = true;
+}
+
+void GBC::writePalette(size_t indexReg, uint8_t * ram, rckid::ColorRGB * rgb, uint8_t value) {
+    uint8_t & index = state_.highMem_[indexReg];
+    size_t i = index & 0x3f;
+    ram[i] = value;
+    rgb[i / 2] = paletteColor(ram, i / 2);
+    if (index & 0x80)
+        index = 0x80 | ((i + 1) & 0x3f);
+}
+
 void GBC::setMode(unsigned mode) {
     IO_STAT &= ~ STAT_PPU_MODE; 
     IO_STAT |= (mode & STAT_PPU_MODE);
     // check the interrupts
     switch (mode) {
         case 0:
+            if (IO_STAT & STAT_INT_MODE0)
+                IO_IF |= IF_LCD;
+            break;
         case 1:
+            IO_IF |= IF_VBLANK;
+            if (IO_STAT & STAT_INT_MODE1)
+                IO_IF |= IF_LCD;
+            break;
         case 2:
+            if (IO_STAT & STAT_INT_MODE2)
+                IO_IF |= IF_LCD;
             break;
     }
 }
 
 void GBC::setLY(uint8_t value) {
     IO_LY = value;
-    if (value == 144)
-        IO_IF |= IF_VBLANK;
     if (value == IO_LYC) {
         IO_STAT |= STAT_LYC_EQ_LY;
         // check LYC LY interrupt
@@ -287,13 +375,135 @@ void GBC::setLY(uint8_t value) {
 }
 
 void GBC::render(size_t & dots) {
-    while (dots >= DOTS_PER_LINE) {
-        /*
-        size_t y = IO_LY;
-        for (size_t x = 0; x < 160; ++x) {
+    if ((IO_LCDC & LCDC_ENABLE) == 0) {
+        dots = 0;
+        ppuEventDots_ = DOTS_PER_LINE;
+        return;
+    }
+    unsigned d = state_.rendererDots_ + dots;
+    dots = 0;
+    while (true) {
+        switch (IO_STAT & STAT_PPU_MODE) {
+            case 2: // OAM scan
+                if (d < DOTS_OAM_SCAN) {
+                    ppuEventDots_ = DOTS_OAM_SCAN - d;
+                    state_.rendererDots_ = d;
+                    return;
+                }
+                setMode(3);
+                break;
+            case 3: // drawing, the whole line is rendered at its end
+                if (d < DOTS_OAM_SCAN + DOTS_DRAW) {
+                    ppuEventDots_ = DOTS_OAM_SCAN + DOTS_DRAW - d;
+                    state_.rendererDots_ = d;
+                    return;
+                }
+                renderLine(IO_LY);
+                setMode(0);
+                break;
+            default: { // hblank & vblank
+                if (d < DOTS_PER_LINE) {
+                    ppuEventDots_ = DOTS_PER_LINE - d;
+                    state_.rendererDots_ = d;
+                    return;
+                }
+                d -= DOTS_PER_LINE;
+                uint8_t ly = IO_LY + 1;
+                if (ly == LINES_PER_FRAME) {
+                    ly = 0;
+                    state_.windowLine_ = 0;
+                }
+                setLY(ly);
+                if (ly < SCREEN_HEIGHT) {
+                    setMode(2);
+                } else if (ly == SCREEN_HEIGHT) {
+                    setMode(1);
+                    frameDone_ = true;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void GBC::renderLine(uint8_t ly) {
+    if (framebuffer_ == nullptr)
+        return;
+    uint8_t lcdc = IO_LCDC;
+    // pixels of the line go right to left, column by column, so that the frame is in the display's native order
+    rckid::ColorRGB * out = framebuffer_ + (SCREEN_WIDTH - 1) * SCREEN_HEIGHT + ly;
+    // for each pixel the background color index (bits 0 and 1) and the background priority attribute (bit 7), used for the sprites 
+    uint8_t info[SCREEN_WIDTH];
+    bool signedTiles = (lcdc & LCDC_TILE_DATA) == 0;
+    int windowX = SCREEN_WIDTH;
+    if ((lcdc & LCDC_WINDOW_ENABLE) && ly >= IO_WY && IO_WX < SCREEN_WIDTH + 7)
+        windowX = IO_WX - 7;
+    renderTiles(out, info, 0, std::max(windowX, 0), (lcdc & LCDC_BG_MAP) ? 0x1c00 : 0x1800, IO_SCX, ly + IO_SCY, signedTiles);
+    if (windowX < SCREEN_WIDTH) {
+        // the window starts at its left edge, or further in if the edge is off screen
+        int x = std::max(windowX, 0);
+        renderTiles(out, info, x, SCREEN_WIDTH, (lcdc & LCDC_WINDOW_MAP) ? 0x1c00 : 0x1800, x - windowX, state_.windowLine_, signedTiles);
+        ++state_.windowLine_;
+    }
+    if (lcdc & LCDC_OBJ_ENABLE)
+        renderSprites(out, info, ly);
+}
 
+void GBC::renderTiles(rckid::ColorRGB * out, uint8_t * info, int x, int end, uint16_t map, uint8_t mx, uint8_t my, bool signedTiles) {
+    uint8_t const * vram = state_.vram_;
+    out -= x * SCREEN_HEIGHT;
+    map += (my >> 3) * 32;
+    while (x < end) {
+        size_t mapIndex = map + (mx >> 3);
+        uint8_t tile = vram[mapIndex];
+        uint8_t attr = vram[State::VRAM_BANK_SIZE + mapIndex];
+        size_t index = signedTiles ? 256 + static_cast<int8_t>(tile) : tile;
+        if (attr & ATTR_BANK)
+            index += TILES_PER_BANK;
+        uint8_t const * row = tileRow(index, (attr & ATTR_FLIP_Y) ? 7 - (my & 7) : (my & 7));
+        rckid::ColorRGB const * palette = bgPalette_ + (attr & ATTR_PALETTE) * 4;
+        uint8_t priority = attr & ATTR_PRIORITY;
+        // draw the rest of the tile row, or until the end
+        for (unsigned px = mx & 7; px < 8 && x < end; ++px, ++x, ++mx, out -= SCREEN_HEIGHT) {
+            unsigned c = row[(attr & ATTR_FLIP_X) ? 7 - px : px];
+            *out = palette[c];
+            info[x] = static_cast<uint8_t>(c | priority);
+        }
+    }
+}
+
+void GBC::renderSprites(rckid::ColorRGB * out, uint8_t * info, uint8_t ly) {
+    uint8_t const * oam = state_.oam_;
+    int height = (IO_LCDC & LCDC_OBJ_SIZE) ? 16 : 8;
+    bool bgPriority = IO_LCDC & LCDC_BG_PRIORITY;
+    // the first 10 sprites in OAM that are on the line are drawn, on CGB lower OAM index has priority, i.e. once a sprite's opaque pixel claims the screen pixel, no other sprite can draw there (marked in bit 2 of info)
+    size_t n = 0;
+    for (size_t i = 0; i < 40 && n < MAX_SPRITES_PER_LINE; ++i) {
+        uint8_t const * s = oam + i * 4;
+        int row = ly + 16 - s[0];
+        if (row < 0 || row >= height)
+            continue;
+        ++n;
+        uint8_t attr = s[3];
+        if (attr & ATTR_FLIP_Y)
+            row = height - 1 - row;
+        size_t index = ((height == 16) ? (s[2] & 0xfe) : s[2]) + (row >> 3) + ((attr & ATTR_BANK) ? TILES_PER_BANK : 0);
+        uint8_t const * pixels = tileRow(index, row & 7);
+        rckid::ColorRGB const * palette = objPalette_ + (attr & ATTR_PALETTE) * 4;
+        int sx = s[1] - 8;
+        for (int px = 0; px < 8; ++px) {
+            int x = sx + px;
+            if (x < 0 || x >= SCREEN_WIDTH || (info[x] & 4))
+                continue;
+            unsigned c = pixels[(attr & ATTR_FLIP_X) ? 7 - px : px];
+            if (c == 0)
+                continue;
+            info[x] |= 4;
+            // the background wins over the sprite if either has the priority attribute, unless the background color is 0, or master priority is off 
+            if (bgPriority && (info[x] & 3) != 0 && ((attr & ATTR_PRIORITY) || (info[x] & ATTR_PRIORITY)))
+                continue;
+            out[- x * SCREEN_HEIGHT] = palette[c];
         }
-        */
     }
 }
 
@@ -306,7 +516,6 @@ void GBC::render(size_t & dots) {
 #define E (state_.rawRegs8_[State::REG_INDEX_E])
 #define H (state_.rawRegs8_[State::REG_INDEX_H])
 #define L (state_.rawRegs8_[State::REG_INDEX_L])
-#define AF (state_.rawRegs16_[State::REG_INDEX_AF])
 #define BC (state_.rawRegs16_[State::REG_INDEX_BC])
 #define DE (state_.rawRegs16_[State::REG_INDEX_DE])
 #define HL (state_.rawRegs16_[State::REG_INDEX_HL])
@@ -314,24 +523,308 @@ void GBC::render(size_t & dots) {
 #define PC (state_.pc_)
 #define SP (state_.sp_)
 
+/** The immediate operands of the instructions. The interpreter loops read them from the code, advancing PC, while the block cache loop redefines them to the pre-decoded operands. 
+ */
+#define IMM8 rd8(PC)
+#define IMM16 rd16(PC)
+
+/** Stores the flags that an instruction sets to constants, i.e. those that are 0 or 1 in its definition, given as the val_ constants (pasted by the caller, as some flag names are also register macros). Done after the instruction body so that the body can still read the old values. 
+ */
+#define CONST_FLAGS(VAL_Z, VAL_N, VAL_H, VAL_C) \
+    if (VAL_Z != -1) state_.setFlagZ(VAL_Z); \
+    if (VAL_N != -1) state_.setFlagN(VAL_N); \
+    if (VAL_H != -1) state_.setFlagH(VAL_H); \
+    if (VAL_C != -1) state_.setFlagC(VAL_C);
+
 void GBC::loop() {
+    switch (dispatch_) {
+#if GBC_THREADED_DISPATCH
+        case Dispatch::Threaded:
+            loopThreaded();
+            break;
+#endif
+        case Dispatch::BlockCache:
+            loopBlocks();
+            break;
+        default:
+            loopSwitch();
+            break;
+    }
+}
+
+void GBC::loopSwitch() {
     cycles_ = 0;
+    ppuCycles_ = 0;
     while (true) {
         uint8_t opcode = rd8(state_.pc_);
         switch (opcode) {
+#define PREFIX_CB(OPCODE) executeCB(OPCODE)
 #define INS(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, SIZE, CYCLES, MNEMONIC, ...) \
     case OPCODE: \
         cycles_ += CYCLES; \
-        if (val_ ## FLAG_Z != -1) state_.setFlagZ(val_ ## FLAG_Z); \
-        if (val_ ## FLAG_N != -1) state_.setFlagN(val_ ## FLAG_N); \
-        if (val_ ## FLAG_H != -1) state_.setFlagH(val_ ## FLAG_H); \
-        if (val_ ## FLAG_C != -1) state_.setFlagC(val_ ## FLAG_C); \
         __VA_ARGS__ \
+        CONST_FLAGS(val_ ## FLAG_Z, val_ ## FLAG_N, val_ ## FLAG_H, val_ ## FLAG_C) \
         break;
 #include "insns.inc.h"
+#undef INS
+#undef PREFIX_CB
            default:
                 ASSERT("Unsupported opcode");
                 break;
         }
+        // only run the PPU when its next event is due, one dot is one cycle in the normal speed mode 
+        size_t dots = cycles_ - ppuCycles_;
+        if (dots >= ppuEventDots_) {
+            ppuCycles_ = cycles_;
+            render(dots);
+            if (frameDone_ && stopAtVBlank_)
+                return;
+        }
+    }
+}
+
+void GBC::executeCB(uint8_t opcode) {
+    switch (opcode) {
+#define CB(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, CYCLES, MNEMONIC, ...) \
+    case OPCODE: \
+        cycles_ += CYCLES; \
+        __VA_ARGS__ \
+        CONST_FLAGS(val_ ## FLAG_Z, val_ ## FLAG_N, val_ ## FLAG_H, val_ ## FLAG_C) \
+        break;
+#include "insns_cb.inc.h"
+#undef CB
+    }
+}
+
+#if GBC_THREADED_DISPATCH
+void GBC::loopThreaded() {
+    // label addresses can only be taken inside the function, so the tables are filled when first called
+    static void * ops[256];
+    static void * cbOps[256];
+    if (ops[0] == nullptr) {
+        for (size_t i = 0; i < 256; ++i)
+            ops[i] = && unsupported;
+#define INS(OPCODE, ...) ops[OPCODE] = && ins_ ## OPCODE;
+#include "insns.inc.h"
+#undef INS
+#define CB(OPCODE, ...) cbOps[OPCODE] = && cb_ ## OPCODE;
+#include "insns_cb.inc.h"
+#undef CB
+    }
+    cycles_ = 0;
+    ppuCycles_ = 0;
+    // every instruction ends by running the PPU if due and jumping straight to the next instruction
+#define NEXT \
+    if (cycles_ - ppuCycles_ >= ppuEventDots_) \
+        goto ppu; \
+    goto * ops[rd8(state_.pc_)];
+
+    goto * ops[rd8(state_.pc_)];
+ppu: {
+        size_t dots = cycles_ - ppuCycles_;
+        ppuCycles_ = cycles_;
+        render(dots);
+        if (frameDone_ && stopAtVBlank_)
+            return;
+        goto * ops[rd8(state_.pc_)];
+    }
+unsupported:
+    ASSERT("Unsupported opcode");
+    NEXT
+#define PREFIX_CB(OPCODE) goto * cbOps[OPCODE]
+#define INS(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, SIZE, CYCLES, MNEMONIC, ...) \
+    ins_ ## OPCODE: { \
+        cycles_ += CYCLES; \
+        __VA_ARGS__ \
+        CONST_FLAGS(val_ ## FLAG_Z, val_ ## FLAG_N, val_ ## FLAG_H, val_ ## FLAG_C) \
+        NEXT \
+    }
+#include "insns.inc.h"
+#undef INS
+#undef PREFIX_CB
+#define CB(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, CYCLES, MNEMONIC, ...) \
+    cb_ ## OPCODE: { \
+        cycles_ += CYCLES; \
+        __VA_ARGS__ \
+        CONST_FLAGS(val_ ## FLAG_Z, val_ ## FLAG_N, val_ ## FLAG_H, val_ ## FLAG_C) \
+        NEXT \
+    }
+#include "insns_cb.inc.h"
+#undef CB
+#undef NEXT
+}
+#endif
+
+// block cache
+
+namespace {
+
+    /** Sizes and cycles of the instructions as given by the instruction tables, used when decoding the blocks. Size of 0 marks unsupported opcodes. The cycles of the prefixed instructions are in addition to the 4 cycles of the prefix. 
+     */
+    struct InsnInfo {
+        uint8_t size[256];
+        uint8_t cycles[256];
+        uint8_t cbCycles[256];
+    }; 
+
+    constexpr InsnInfo insnInfo = []() {
+        InsnInfo result{};
+#define INS(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, SIZE, CYCLES, ...) \
+        result.size[OPCODE] = SIZE; \
+        result.cycles[OPCODE] = CYCLES;
+#include "insns.inc.h"
+#undef INS
+#define CB(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, CYCLES, ...) \
+        result.cbCycles[OPCODE] = CYCLES;
+#include "insns_cb.inc.h"
+#undef CB
+        return result;
+    }();
+
+    /** Returns true if the instruction changes PC other than by advancing it (jumps, calls, returns and restarts), or stops the execution, i.e. if it ends the block. 
+     */
+    bool endsBlock(uint8_t opcode) {
+        switch (opcode) {
+            case 0x10: // stop
+            case 0x18: case 0x20: case 0x28: case 0x30: case 0x38: // jr
+            case 0x76: // halt
+            case 0xc0: case 0xc8: case 0xc9: case 0xd0: case 0xd8: case 0xd9: // ret, reti
+            case 0xc2: case 0xc3: case 0xca: case 0xd2: case 0xda: case 0xe9: // jp
+            case 0xc4: case 0xcc: case 0xcd: case 0xd4: case 0xdc: // call
+            case 0xc7: case 0xcf: case 0xd7: case 0xdf: case 0xe7: case 0xef: case 0xf7: case 0xff: // rst
+                return true;
+            default:
+                return false;
+        }
+    }
+
+} // anonymous namespace
+
+void GBC::invalidateBlocks() {
+    // only the block cache dispatch uses the cache, so the others do not pay for its memory
+    if (dispatch_ != Dispatch::BlockCache) {
+        delete [] blocks_;
+        delete [] blockOps_;
+        blocks_ = nullptr;
+        blockOps_ = nullptr;
+        blockOpsUsed_ = 0;
+        return;
+    }
+    if (blocks_ == nullptr) {
+        blocks_ = new Block[BLOCK_CACHE_ENTRIES];
+        blockOps_ = new BlockOp[BLOCK_CACHE_OPS];
+    }
+    for (size_t i = 0; i < BLOCK_CACHE_ENTRIES; ++i)
+        blocks_[i].numOps = 0;
+    blockOpsUsed_ = 0;
+}
+
+void GBC::decodeBlock(Block & block, uint16_t pc, uint16_t bank) {
+    // when the pool cannot fit another block, start over
+    if (blockOpsUsed_ + MAX_BLOCK_OPS > BLOCK_CACHE_OPS)
+        invalidateBlocks();
+    block.pc = pc;
+    block.bank = bank;
+    block.first = static_cast<uint16_t>(blockOpsUsed_);
+    block.numOps = 0;
+    block.cycles = 0;
+    // the block must not run past the end of the ROM region, nor past the end of the ROM itself
+    uint16_t end = (pc < 0x4000) ? 0x4000 : 0x8000;
+    uint16_t addr = pc;
+    while (block.numOps < MAX_BLOCK_OPS) {
+        size_t romAddr = bank * State::ROM_BANK_SIZE + (addr & (State::ROM_BANK_SIZE - 1));
+        if (romAddr >= state_.romSize_)
+            break;
+        uint8_t opcode = state_.memMap_[addr >> 12][addr & 0xfff];
+        unsigned size = insnInfo.size[opcode];
+        if (size == 0 || addr + size > end || romAddr + size > state_.romSize_)
+            break;
+        uint16_t next = addr + 1;
+        BlockOp & op = blockOps_[blockOpsUsed_++];
+        op.opcode = opcode;
+        op.cycles = insnInfo.cycles[opcode];
+        op.operand = (size == 3) ? rd16(next) : (size == 2) ? rd8(next) : 0;
+        op.next = next;
+        block.cycles += op.cycles;
+        if (opcode == 0xcb)
+            block.cycles += insnInfo.cbCycles[op.operand];
+        ++block.numOps;
+        addr = next;
+        if (endsBlock(opcode))
+            break;
+    }
+}
+
+void GBC::loopBlocks() {
+    cycles_ = 0;
+    ppuCycles_ = 0;
+    // runs the PPU if its next event is due, one dot is one cycle in the normal speed mode 
+#define RUN_PPU \
+    if (cycles_ - ppuCycles_ >= ppuEventDots_) { \
+        size_t dots = cycles_ - ppuCycles_; \
+        ppuCycles_ = cycles_; \
+        render(dots); \
+        if (frameDone_ && stopAtVBlank_) \
+            return; \
+    }
+    Block const * block = nullptr;
+    while (true) {
+        // small loops jump back to the start of their own block, which can then run again without being looked up
+        if (block != nullptr && block->pc == PC && (block->pc < 0x4000 || block->bank == state_.romBank_))
+            ++blockStats_.hits;
+        else
+            block = findBlock(PC);
+        if (block != nullptr) {
+            // unless the PPU is due before the block's end, the block runs without checking it after every instruction
+            bool checkPPU = cycles_ - ppuCycles_ + block->cycles >= ppuEventDots_;
+            BlockOp const * op = blockOps_ + block->first;
+            blockOpsLeft_ = block->numOps;
+            while (blockOpsLeft_ > 0) {
+                --blockOpsLeft_;
+                PC = op->next;
+                cycles_ += op->cycles;
+                switch (op->opcode) {
+#undef IMM8
+#undef IMM16
+#define IMM8 static_cast<uint8_t>(op->operand)
+#define IMM16 (op->operand)
+#define PREFIX_CB(OPCODE) executeCB(OPCODE)
+#define INS(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, SIZE, CYCLES, MNEMONIC, ...) \
+    case OPCODE: \
+        __VA_ARGS__ \
+        CONST_FLAGS(val_ ## FLAG_Z, val_ ## FLAG_N, val_ ## FLAG_H, val_ ## FLAG_C) \
+        break;
+#include "insns.inc.h"
+#undef INS
+#undef PREFIX_CB
+#undef IMM8
+#undef IMM16
+#define IMM8 rd8(PC)
+#define IMM16 rd16(PC)
+                }
+                ++op;
+                if (checkPPU)
+                    RUN_PPU
+            }
+        } else {
+            ++blockStats_.interpreted;
+            switch (rd8(state_.pc_)) {
+#define PREFIX_CB(OPCODE) executeCB(OPCODE)
+#define INS(OPCODE, FLAG_Z, FLAG_N, FLAG_H, FLAG_C, SIZE, CYCLES, MNEMONIC, ...) \
+    case OPCODE: \
+        cycles_ += CYCLES; \
+        __VA_ARGS__ \
+        CONST_FLAGS(val_ ## FLAG_Z, val_ ## FLAG_N, val_ ## FLAG_H, val_ ## FLAG_C) \
+        break;
+#include "insns.inc.h"
+#undef INS
+#undef PREFIX_CB
+                default:
+                    ASSERT("Unsupported opcode");
+                    break;
+            }
+        }
+        RUN_PPU
     }
+#undef RUN_PPU
 }
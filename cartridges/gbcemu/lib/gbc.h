@@ -3,6 +3,17 @@
 #include <cstdint>
 
 #include "rckid/rckid.h"
+#include "rckid/graphics/color.h"
+
+/** Enables the threaded dispatch of the interpreter loop where the compiler supports it, see GBC::Dispatch. 
+ */
+#ifndef GBC_THREADED_DISPATCH
+#if defined(__GNUC__)
+#define GBC_THREADED_DISPATCH 1
+#else
+#define GBC_THREADED_DISPATCH 0
+#endif
+#endif
 
 /** GameBoy Color Emulator.
 
@@ -36,11 +47,13 @@ public:
             - SP (stack pointer)
             - PC (program counter)
 
-            The AF, BC, DE, HL 16bit registers share the same space with their 8bit counterparts. 
+            The AF, BC, DE, HL 16bit registers share the same space with their 8bit counterparts. The only exception is the F register, which is evaluated from the lazy flags when read (see below). 
          */
         //@{
         uint8_t a() const { return rawRegs8_[REG_INDEX_A]; }
-        uint8_t f() const { return rawRegs8_[REG_INDEX_F]; }
+        uint8_t f() const {
+            return (flagZ() ? FLAG_Z : 0) | (flagN() ? FLAG_N : 0) | (flagH() ? FLAG_H : 0) | (flagC() ? FLAG_C : 0);
+        }
         uint8_t b() const { return rawRegs8_[REG_INDEX_B]; }
         uint8_t c() const { return rawRegs8_[REG_INDEX_C]; }
         uint8_t d() const { return rawRegs8_[REG_INDEX_D]; }
@@ -48,7 +61,7 @@ public:
         uint8_t h() const { return rawRegs8_[REG_INDEX_H]; }
         uint8_t l() const { return rawRegs8_[REG_INDEX_L]; }
 
-        uint16_t af() const { return rawRegs16_[REG_INDEX_AF]; }
+        uint16_t af() const { return static_cast<uint16_t>((a() << 8) | f()); }
         uint16_t bc() const { return rawRegs16_[REG_INDEX_BC]; }
         uint16_t de() const { return rawRegs16_[REG_INDEX_DE]; }
         uint16_t hl() const { return rawRegs16_[REG_INDEX_HL]; }
@@ -63,13 +76,14 @@ public:
             - `N` (subtract flag) set to a constant it seems
             - `H` (half carry flag) 
             - `C` (carry flag)
-         
+
+            Most instructions change the flags, but only few read them, so instead of updating the F register bit by bit, the flags are stored lazily as the values they are computed from and only evaluated when read. Z is set if the last stored result is 0, H is bit 4 of the xor of the operands and the result (i.e. the carry into bit 4) and C is bit 8 of the unmasked result. The F register itself is assembled by f() when it is read, i.e. by push af or the tests.
         */
         //@{
-        bool flagZ() const { return rawRegs8_[REG_INDEX_F] & FLAG_Z; }
-        bool flagN() const { return rawRegs8_[REG_INDEX_F] & FLAG_N; }
-        bool flagH() const { return rawRegs8_[REG_INDEX_F] & FLAG_H; }
-        bool flagC() const { return rawRegs8_[REG_INDEX_F] & FLAG_C; }
+        bool flagZ() const { return flagZ_ == 0; }
+        bool flagN() const { return flagN_; }
+        bool flagH() const { return flagH_ & 0x10; }
+        bool flagC() const { return flagC_ & 0x100; }
         //@}
 
         /** \name Memory 
@@ -132,6 +146,16 @@ public:
 
         //@}
 
+        /** \name CGB Palettes
+         
+            There are 8 background and 8 object palettes of 4 colors each. The colors are stored as little endian 15bit values with 5 bits for red, green and blue (from the least significant bits) and are accessed via the BCPS/BCPD and OCPS/OCPD registers. 
+         */
+        //@{
+        uint8_t const * bgPaletteRam() const { return bgPaletteRam_; }
+        uint8_t const * objPaletteRam() const { return objPaletteRam_; }
+        size_t paletteRamSize() const { return 64; }
+        //@}
+
     private:
 
         friend class GBC;
@@ -170,6 +194,7 @@ public:
         void initialize() {
             for (size_t i = 0; i < sizeof(rawRegs8_); ++i)
                 rawRegs8_[i] = 0;
+            setF(0);
             for (size_t i = 0; i < 16; ++i)
                 memMap_[i] = nullptr;
             delete [] vram_;
@@ -183,6 +208,17 @@ public:
             eramSize_ = 0;
             oam_ = new uint8_t[oamSize()];
             highMem_ = new uint8_t[256]; 
+            for (size_t i = 0; i < 256; ++i)
+                highMem_[i] = 0;
+            // the state after the boot rom, i.e. LCD and background on, PPU at the beginning of the first line
+            highMem_[0x40] = 0x91;
+            highMem_[0x41] = 2;
+            for (size_t i = 0; i < sizeof(bgPaletteRam_); ++i) {
+                bgPaletteRam_[i] = 0xff;
+                objPaletteRam_[i] = 0xff;
+            }
+            rendererDots_ = 0;
+            windowLine_ = 0;
             memMap_[MEMMAP_REGION_WRAM] = wram_;
             memMap_[MEMMAP_REGION_ECHO_RAM] = wram_;
             setVideoRAMBank(0);
@@ -190,19 +226,38 @@ public:
             ime_ = true;
         } 
 
-        void setFlagZ(bool value) { value ? rawRegs8_[REG_INDEX_F] |= FLAG_Z : rawRegs8_[REG_INDEX_F] &= ~FLAG_Z; }
+        void setFlagZ(bool value) { flagZ_ = value ? 0 : 1; }
 
-        void setFlagN(bool value) { value ? rawRegs8_[REG_INDEX_F] |= FLAG_N : rawRegs8_[REG_INDEX_F] &= ~FLAG_N; }
+        void setFlagN(bool value) { flagN_ = value; }
 
-        void setFlagH(bool value) { value ? rawRegs8_[REG_INDEX_F] |= FLAG_H : rawRegs8_[REG_INDEX_F] &= ~FLAG_H; }
+        void setFlagH(bool value) { flagH_ = value ? 0x10 : 0; }
 
-        void setFlagC(bool value) { value ? rawRegs8_[REG_INDEX_F] |= FLAG_C : rawRegs8_[REG_INDEX_F] &= ~FLAG_C; }
+        void setFlagC(bool value) { flagC_ = value ? 0x100 : 0; }
 
+        /** Sets the Z flag from the given result. 
+         */
         uint8_t setFlagZFrom(uint8_t value) {
-            setFlagZ(value == 0);
+            flagZ_ = value;
             return value;
         }
 
+        /** Sets the H flag from the operands and the result, i.e. to the carry (or borrow) into bit 4. For 16bit operations, pass the values shifted by 8 bits. 
+         */
+        void setFlagHFrom(unsigned a, unsigned b, unsigned result) { flagH_ = a ^ b ^ result; }
+
+        /** Sets the C flag from the unmasked result, i.e. to its bit 8. 
+         */
+        void setFlagCFrom(unsigned result) { flagC_ = result; }
+
+        /** Sets all flags from the F register value. 
+         */
+        void setF(uint8_t value) {
+            setFlagZ(value & FLAG_Z);
+            setFlagN(value & FLAG_N);
+            setFlagH(value & FLAG_H);
+            setFlagC(value & FLAG_C);
+        }
+
         void setVideoRAMBank(size_t index) {
             memMap_[MEMMAP_REGION_VRAM] = vram_ + (index * VRAM_BANK_SIZE);
             memMap_[MEMMAP_REGION_VRAM + 1] = vram_ + (index * VRAM_BANK_SIZE) + MEMMAP_REGION_SIZE;
@@ -215,6 +270,7 @@ public:
 
         // depends on memory controller in cartridge
         void setROMBank(size_t bank) {
+            romBank_ = bank;
             for (size_t i = 0; i < 4; ++i)
                 memMap_[MEMMAP_REGION_ROM + i] = const_cast<uint8_t *>(rom_ + (ROM_BANK_SIZE * bank) + (MEMMAP_REGION_SIZE * i));
         }
@@ -232,10 +288,18 @@ public:
         uint16_t sp_;
         uint16_t pc_;
 
+        /** The lazy flags, see flagZ(), flagN(), flagH() and flagC(). 
+         */
+        uint8_t flagZ_;
+        bool flagN_;
+        unsigned flagH_;
+        unsigned flagC_;
+
         uint8_t * memMap_[16];
 
         uint8_t const * rom_ = nullptr;
         size_t romSize_ = 0;
+        size_t romBank_ = 1;
 
         uint8_t * vram_ = nullptr;
         uint8_t * wram_ = nullptr;
@@ -247,14 +311,109 @@ public:
         bool ime_ = false;
 
 
+        uint8_t bgPaletteRam_[64];
+        uint8_t objPaletteRam_[64];
+
+        /** Dots elapsed on the current line. 
+         */
         unsigned rendererDots_ = 0;
+        /** Line of the window to be drawn next, which only advances on lines where the window is visible. 
+         */
+        uint8_t windowLine_ = 0;
 
     }; // GBC::State
 
 
+    /** Interpreter loop dispatch variants. 
+
+        The switch dispatch is portable, while the threaded dispatch requires the labels as values extension (GCC and clang), which can be disabled by setting GBC_THREADED_DISPATCH to 0. If available, the threaded dispatch is the default. The block cache dispatch executes pre-decoded blocks of instructions (see the block cache below). It is not generally faster than the other dispatches (see the dispatch benchmark) and has to be selected explicitly.
+     */
+    enum class Dispatch {
+        Switch,
+#if GBC_THREADED_DISPATCH
+        Threaded,
+#endif
+        BlockCache,
+#if GBC_THREADED_DISPATCH
+        Default = Threaded,
+#else
+        Default = Switch,
+#endif
+    }; 
+
+    /** Block cache statistics. 
+     
+        Hits and misses count the block lookups, a miss being a lookup that had to decode the block. Interpreted is the number of instructions executed one by one instead, because there is no block for them (code outside of ROM). 
+     */
+    struct BlockStats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t interpreted = 0;
+    };
+
+    /** Size of the GBC screen. 
+     */
+    static constexpr rckid::Coord SCREEN_WIDTH = 160;
+    static constexpr rckid::Coord SCREEN_HEIGHT = 144;
+
     GBC() {}
 
+    ~GBC() {
+        delete [] tileCache_;
+        delete [] blocks_;
+        delete [] blockOps_;
+    }
+
+    GBC(GBC const &) = delete;
+
+    /** Sets the buffer the PPU renders into, or nullptr to disable rendering. 
+     
+        The buffer must be SCREEN_WIDTH x SCREEN_HEIGHT pixels in the display's native column-first, right to left order, i.e. the buffer of a Bitmap<ColorRGB>, which can then be sent to the display as it is. As the PPU writes the pixels directly, the bitmap does not know it has changed and the caller must mark it dirty (Bitmap::markDirty()) after every emulated frame, otherwise the renderer sends nothing. 
+     */
+    void setFramebuffer(rckid::ColorRGB * buffer) { framebuffer_ = buffer; }
+
+    /** Invalidates the decoded tile cache. 
+     
+        VRAM writes by the emulated code invalidate their tiles automatically, but the cache must be invalidated when the VRAM is changed directly via the state. 
+     */
+    void invalidateTiles() {
+        for (size_t i = 0; i < TILE_CACHE_TILES; ++i)
+            tileValid_[i] = false;
+    }
+
+    /** Invalidates the block cache. 
+     
+        Blocks are keyed by the ROM bank and address so that they stay valid when the bank is switched. The cache must be invalidated when the ROM itself changes, which runTest() does. 
+
+        The cache is only allocated when the block cache dispatch is selected, for the other dispatches its memory is freed instead.
+     */
+    void invalidateBlocks();
+
+    BlockStats const & blockStats() const { return blockStats_; }
+
+    void resetBlockStats() { blockStats_ = BlockStats{}; }
+
+    Dispatch dispatch() const { return dispatch_; }
+
+    /** Selects the interpreter loop dispatch variant. The default one is selected at build time, this is useful for benchmarking. 
+     */
+    void setDispatch(Dispatch value) { 
+        dispatch_ = value; 
+        invalidateBlocks();
+    }
+
+    /** Runs the emulator until the PPU enters VBLANK, i.e. until the whole frame has been rendered. 
+     */
+    void runFrame() {
+        frameDone_ = false;
+        stopAtVBlank_ = true;
+        loop();
+        stopAtVBlank_ = false;
+    }
+
     void start(uint16_t pc = 0x100) {
+        resetPPU();
+        invalidateBlocks();
         state_.pc_ = pc;
         terminateAfterStop_ = false;
         loop();
@@ -270,8 +429,11 @@ public:
      */
     void runTest(uint8_t const * rom, size_t numBytes, uint16_t pc = 0x0) {
         state_.initialize();
+        resetPPU();
         // set the rom & set bank to 0
         state_.setRom(rom, numBytes);
+        invalidateBlocks();
+        resetBlockStats();
         // set pc, enable stop termination and run the emulator loop
         state_.pc_ = pc;
         cycles_ = 0;
@@ -352,13 +514,21 @@ private:
         bit 7 = LCD & PPU enable / disable
         bit 6 = window tilemap area ( 0 == 0x9800 - 9bff, 1 = 0x9c00 - 0x9fff)
         bit 5 = window enable 
-        bit 4 = BG & Window tilemap area ( 0 = 0x9800 - 0x9bfff, 1 = 0x9c00 - 0x9fff)
+        bit 4 = BG & Window tile data area ( 0 = 0x8800 - 0x97ff with signed tile indices, 1 = 0x8000 - 0x8fff)
         bit 3 = BG tilemap area ( 0 = 0x9800 - 0x9bfff, 1 = 0x9c00 - 0x9fff)
         bit 2 = OBJ size (0 = 8x8, 1 = 8x16)
         bit 1 = OBJ enable
         bit 0 = BG/Win enable / priority -- CGB Specific
     */
     static constexpr size_t ADDR_IO_LCDC = 0x40;
+    static constexpr uint8_t LCDC_ENABLE = 1 << 7;
+    static constexpr uint8_t LCDC_WINDOW_MAP = 1 << 6;
+    static constexpr uint8_t LCDC_WINDOW_ENABLE = 1 << 5;
+    static constexpr uint8_t LCDC_TILE_DATA = 1 << 4;
+    static constexpr uint8_t LCDC_BG_MAP = 1 << 3;
+    static constexpr uint8_t LCDC_OBJ_SIZE = 1 << 2;
+    static constexpr uint8_t LCDC_OBJ_ENABLE = 1 << 1;
+    static constexpr uint8_t LCDC_BG_PRIORITY = 1 << 0;
     /** Status and interrupts for the LCD driver
      
         bit 6 = LYC int select
@@ -398,6 +568,8 @@ private:
     static constexpr size_t ADDR_IO_HDMA4 = 0x54;
     static constexpr size_t ADDR_IO_HDMA5 = 0x55;
     static constexpr size_t ADDR_IO_RP = 0x56;
+    /** Palette index registers, bits 0..5 are the byte index in the palette RAM, bit 7 enables autoincrement after each write to the data register. 
+     */
     static constexpr size_t ADDR_IO_BCPS_BGPI = 0x68;
     static constexpr size_t ADDR_IO_BCPD_BGPD = 0x69;
     static constexpr size_t ADDR_IO_OCPS_OCPI = 0x6a;
@@ -437,6 +609,7 @@ private:
     uint8_t __force_inline sla8(uint8_t a);
     uint8_t __force_inline sra8(uint8_t a);
     uint8_t __force_inline srl8(uint8_t a);
+    uint8_t __force_inline swap8(uint8_t a);
 
     //@}
 
@@ -454,18 +627,173 @@ private:
     //@{
 
     static constexpr size_t DOTS_PER_LINE = 456;
+    static constexpr size_t DOTS_OAM_SCAN = 80;
+    /** The drawing takes at least 172 dots, the extra dots for sprites and scrolling are not emulated. 
+     */
+    static constexpr size_t DOTS_DRAW = 172;
+    static constexpr uint8_t LINES_PER_FRAME = 154;
+
+    /** Tile map attributes (stored in VRAM bank 1) and OAM sprite attributes. 
+     */
+    static constexpr uint8_t ATTR_PALETTE = 7;
+    static constexpr uint8_t ATTR_BANK = 1 << 3;
+    static constexpr uint8_t ATTR_FLIP_X = 1 << 5;
+    static constexpr uint8_t ATTR_FLIP_Y = 1 << 6;
+    static constexpr uint8_t ATTR_PRIORITY = 1 << 7;
+
+    static constexpr size_t MAX_SPRITES_PER_LINE = 10;
+
+    /** Tiles are stored in VRAM at 0x8000 - 0x97ff in each bank as 2bpp bitplanes, i.e. each row as two bytes with the low and high bits of its 8 pixels. 
+     */
+    static constexpr size_t TILES_PER_BANK = 384;
+    static constexpr size_t TILE_CACHE_TILES = TILES_PER_BANK * 2;
+    static constexpr uint16_t ADDR_TILE_DATA_END = 0x9800;
 
+    /** Brings the PPU in sync with the state, i.e. converts the palettes and schedules the next event. 
+     */
+    void resetPPU();
     void setMode(unsigned mode);
     /** Sets the Y LCD coordinate (currently drawn row)*/
     void setLY(uint8_t value);
+    /** Advances the PPU by given number of dots, changing modes, rendering lines and raising the interrupts as they happen. Updates ppuEventDots_ to the number of dots till the next PPU event. 
+     */
     void render(size_t & dots);
+    /** Renders the given line into the framebuffer. 
+     */
+    void renderLine(uint8_t ly);
+    /** Renders the pixels from x to end (exclusive) of the line from the given tile map. The mx and my are the coordinates of the first pixel in the 256x256 map. 
+     */
+    void renderTiles(rckid::ColorRGB * out, uint8_t * info, int x, int end, uint16_t map, uint8_t mx, uint8_t my, bool signedTiles);
+    void renderSprites(rckid::ColorRGB * out, uint8_t * info, uint8_t ly);
+    /** Writes the palette data register, i.e. the byte of palette RAM pointed to by the index register, updating the RGB palette and incrementing the index if requested. 
+     */
+    void writePalette(size_t indexReg, uint8_t * ram, rckid::ColorRGB * rgb, uint8_t value);
+    static rckid::ColorRGB paletteColor(uint8_t const * ram, size_t index);
+
+    /** Returns the given row of the tile (0 - 767, i.e. including the bank) as 8 color indices, left to right. 
+     */
+    uint8_t const * tileRow(size_t tile, unsigned row) {
+        if (! tileValid_[tile])
+            decodeTile(tile);
+        return tileCache_ + (tile * 8 + row) * 8;
+    }
+
+    /** Decodes all rows of the tile from the VRAM bitplanes into the tile cache. 
+     */
+    void decodeTile(size_t tile);
+
+    rckid::ColorRGB * framebuffer_ = nullptr;
+    /** The palettes converted to RGB so that the renderer can use them directly. 
+     */
+    rckid::ColorRGB bgPalette_[32];
+    rckid::ColorRGB objPalette_[32];
+    /** Dots till the next PPU event. The interpreter only calls render() when due. 
+     */
+    size_t ppuEventDots_ = 0;
+    /** Cycles already accounted for by the PPU, i.e. the value of cycles_ when render() was last called. Turning the LCD on moves it to the current cycle, as the PPU starts afresh.
+     */
+    size_t ppuCycles_ = 0;
+    bool frameDone_ = false;
+    bool stopAtVBlank_ = false;
+
+    /** Decoded tile cache, i.e. the tiles of both VRAM banks with one byte per pixel so that the renderer does not have to decode the bitplanes for every line. A tile is decoded when first used and invalidated by any write to its VRAM.  
+     */
+    uint8_t * tileCache_ = nullptr;
+    bool tileValid_[TILE_CACHE_TILES] = {};
 
     //@}
 
-    /** The interpreter loop. 
+    /** The interpreter loop, which runs the dispatch variant selected by setDispatch(). 
      */
     void loop();
 
+    /** The interpreter loop as a switch statement over the opcodes. 
+     */
+    void loopSwitch();
+
+    /** Executes the prefixed instruction with given opcode, used by loopSwitch(). 
+     */
+    void executeCB(uint8_t opcode);
+
+#if GBC_THREADED_DISPATCH
+    /** The interpreter loop with threaded dispatch, i.e. every instruction jumps directly to the next one via a table of label addresses. 
+     */
+    void loopThreaded();
+#endif
+
+    /** The interpreter loop that executes the blocks from the block cache. 
+     */
+    void loopBlocks();
+
+    /** \name Block cache
+     
+        Most of the time is spent in small loops in ROM, such as waiting for vblank or copying memory. Instead of fetching and decoding every instruction through the memory map each time it executes, straight runs of instructions are decoded once into blocks of pre-decoded instructions with their immediate operands already read. A block ends after any instruction that changes PC other than by advancing it, at the end of the ROM region, or after MAX_BLOCK_OPS instructions. 
+
+        Each block knows the cycles it takes at most (i.e. with any branch taken), so that when the PPU is not due before its end, the whole block runs without checking the PPU after every instruction. Small loops that jump back to the start of their own block run it again without looking it up. Instructions that require the PPU to run immediately (turning the LCD on or off), or that may switch the ROM bank end the block early, see blockOpsLeft_. 
+
+        Only code in ROM is cached, as it cannot be written to. The blocks are keyed by the ROM bank and address in a direct mapped table with their instructions allocated from a shared pool. When the pool is full, the whole cache is invalidated. 
+     */
+    //@{
+
+    static constexpr size_t BLOCK_CACHE_ENTRIES = 256;
+    static constexpr size_t BLOCK_CACHE_OPS = 2048;
+    static constexpr size_t MAX_BLOCK_OPS = 16;
+
+    /** Pre-decoded instruction, i.e. the opcode with its cycles, the immediate operand, or the opcode of the prefixed instruction, and the address of the next instruction. 
+     */
+    struct BlockOp {
+        uint8_t opcode;
+        uint8_t cycles;
+        uint16_t operand;
+        uint16_t next;
+    }; 
+
+    struct Block {
+        uint16_t pc;
+        uint16_t bank;
+        /** Index of the first instruction in the pool. 
+         */
+        uint16_t first;
+        /** Number of instructions, 0 for empty entries. 
+         */
+        uint8_t numOps;
+        /** The cycles of the whole block with all branches taken. 
+         */
+        uint16_t cycles;
+    }; 
+
+    /** Returns the block starting at given address, decoding it if not cached, or nullptr if the code cannot be cached. 
+     */
+    Block const * findBlock(uint16_t pc) {
+        if (pc >= 0x8000)
+            return nullptr;
+        uint16_t bank = (pc < 0x4000) ? 0 : static_cast<uint16_t>(state_.romBank_);
+        Block & block = blocks_[(pc ^ (bank << 5)) % BLOCK_CACHE_ENTRIES];
+        if (block.numOps != 0 && block.pc == pc && block.bank == bank) {
+            ++blockStats_.hits;
+        } else {
+            ++blockStats_.misses;
+            decodeBlock(block, pc, bank);
+        }
+        return (block.numOps != 0) ? & block : nullptr;
+    }
+
+    /** Decodes the block starting at given address into the cache entry. 
+     */
+    void decodeBlock(Block & block, uint16_t pc, uint16_t bank);
+
+    Block * blocks_ = nullptr;
+    BlockOp * blockOps_ = nullptr;
+    size_t blockOpsUsed_ = 0;
+    /** Instructions left in the block being executed. Set to 0 to end the block after the current instruction. 
+     */
+    unsigned blockOpsLeft_ = 0;
+    BlockStats blockStats_;
+
+    //@}
+
+    Dispatch dispatch_ = Dispatch::Default;
+
     // number of cycles ellapsed since last timed event
     size_t cycles_;
 
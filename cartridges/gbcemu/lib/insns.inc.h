@@ -3,42 +3,42 @@
 INS(0x00, _,_,_,_, 1, 4 , "nop", {})
 /** Loads the immediate 16bit data into the bc register. 
  */
-INS(0x01, _,_,_,_, 3, 12, "ld bc, n16", { BC = rd16(PC); })
+INS(0x01, _,_,_,_, 3, 12, "ld bc, n16", { BC = IMM16; })
 INS(0x02, _,_,_,_, 1, 8 , "ld [bc], a", { write8(BC, A); })
 INS(0x03, _,_,_,_, 1, 8 , "inc bc", { ++BC; })
 INS(0x04, Z,0,H,_, 1, 4 , "inc b", { B = inc8(B); })
 INS(0x05, Z,1,H,_, 1, 4 , "dec b", { B = dec8(B); })
-INS(0x06, _,_,_,_, 2, 8 , "ld b, n8", { B = rd8(PC); })
+INS(0x06, _,_,_,_, 2, 8 , "ld b, n8", { B = IMM8; })
 INS(0x07, 0,0,0,C, 1, 4 , "rlca", { A = rlc8(A); })
 /** Stores stack pointer value at the different address. 
  
     addr = SP & 0xff
     addr + 1 = SP >> 8
 */
-INS(0x08, _,_,_,_, 3, 20, "ld [n16], sp", { write16(rd16(PC), SP); })
+INS(0x08, _,_,_,_, 3, 20, "ld [n16], sp", { write16(IMM16, SP); })
 INS(0x09, _,0,H,C, 1, 8 , "add hl, bc", { HL = add16(HL, BC); })
 INS(0x0a, _,_,_,_, 1, 8 , "ld a, [bc]", { A = read8(BC); })
 INS(0x0b, _,_,_,_, 1, 8 , "dec bc", { --BC; })
 INS(0x0c, Z,0,H,_, 1, 4 , "inc c", { C = inc8(C); })
 INS(0x0d, Z,1,H,_, 1, 4 , "dec c", { C = dec8(C); })
-INS(0x0e, _,_,_,_, 2, 8 , "ld c, n8", { C = rd8(PC); })
+INS(0x0e, _,_,_,_, 2, 8 , "ld c, n8", { C = IMM8; })
 INS(0x0f, 0,0,0,C, 1, 4 , "rrca", { A = rrc8(A); })
 /** The stop instruction is also used to stop a program when necessary, which is used for testing extensively. 
  */
 INS(0x10, _,_,_,_, 2, 4 , "stop n8", {
-    rd8(PC);
+    static_cast<void>(IMM8);
     if (terminateAfterStop_)
         return;
 })
-INS(0x11, _,_,_,_, 3, 12, "ld de, n16", { DE = rd16(PC); })
+INS(0x11, _,_,_,_, 3, 12, "ld de, n16", { DE = IMM16; })
 INS(0x12, _,_,_,_, 1, 8 , "ld [de], a", { write8(DE, A); })
 INS(0x13, _,_,_,_, 1, 8 , "inc de", { ++DE; })
 INS(0x14, Z,0,H,_, 1, 4 , "inc d", { D = inc8(D); })
 INS(0x15, Z,1,H,_, 1, 4 , "dec d", { D = dec8(D); })
-INS(0x16, _,_,_,_, 2, 8 , "ld d, n8", { D = rd8(PC); })
+INS(0x16, _,_,_,_, 2, 8 , "ld d, n8", { D = IMM8; })
 INS(0x17, 0,0,0,C, 1, 4 , "rla", { A = rl8(A); })
 INS(0x18, _,_,_,_, 2, 12, "jr e8", {
-    int8_t offset = static_cast<int8_t>(rd8(PC));
+    int8_t offset = static_cast<int8_t>(IMM8);
     PC += offset;
 })
 INS(0x19, _,0,H,C, 1, 8 , "add hl, de", { HL = add16(HL, DE); })
@@ -46,22 +46,22 @@ INS(0x1a, _,_,_,_, 1, 8 , "ld a, [de]", { A = read8(DE); })
 INS(0x1b, _,_,_,_, 1, 8 , "dec de", { --DE; })
 INS(0x1c, Z,0,H,_, 1, 4 , "inc e", { E = inc8(E); })
 INS(0x1d, Z,1,H,_, 1, 4 , "dec e", { E = dec8(E); })
-INS(0x1e, _,_,_,_, 2, 8 , "ld e, n8", { E = rd8(PC); })
+INS(0x1e, _,_,_,_, 2, 8 , "ld e, n8", { E = IMM8; })
 INS(0x1f, 0,0,0,C, 1, 4 , "rra", { A = rr8(A); })
 INS(0x20, _,_,_,_, 2, 8 + 4, "jr nz, e8", {
     // 3 cycles when taken, 2 when not taken
-    int8_t offset = static_cast<int8_t>(rd8(PC));
+    int8_t offset = static_cast<int8_t>(IMM8);
     if (! state_.flagZ())
         PC += offset;
     else
         cycles_ -= 4;
 })
-INS(0x21, _,_,_,_, 3, 12, "ld hl, n16", { HL = rd16(PC); })
+INS(0x21, _,_,_,_, 3, 12, "ld hl, n16", { HL = IMM16; })
 INS(0x22, _,_,_,_, 1, 8 , "ld [hl+], a", { write8(HL, A); ++HL; })
 INS(0x23, _,_,_,_, 1, 8 , "inc hl", { ++HL; })
 INS(0x24, Z,0,H,_, 1, 4 , "inc h", { H = inc8(H); })
 INS(0x25, Z,1,H,_, 1, 4 , "dec h", { H = dec8(H); })
-INS(0x26, _,_,_,_, 2, 8 , "ld h, n8", { H = rd8(PC); })
+INS(0x26, _,_,_,_, 2, 8 , "ld h, n8", { H = IMM8; })
 /** Actually quite fancy adjust instruction for BCD encoded values. 
  
     Using the C, N and H flags, a value in the A register is reconstructed to proper BCD, assuming it has been formed by adding or subtracting BCD numbers before.
@@ -80,11 +80,11 @@ INS(0x27, Z,_,0,C, 1, 4 , "daa", {
         if (state_.flagH() || (A & 0xf) > 0x09) 
             A += 0x06;
     }
-    state_.setFlagZ(A == 0);
+    state_.setFlagZFrom(A);
 })
 INS(0x28, _,_,_,_, 2, 8 + 4, "jr z, e8", {
     // 3 cycles when taken, 2 when not taken
-    int8_t offset = static_cast<int8_t>(rd8(PC));
+    int8_t offset = static_cast<int8_t>(IMM8);
     if (state_.flagZ())
         PC += offset;
     else
@@ -95,28 +95,28 @@ INS(0x2a, _,_,_,_, 1, 8 , "ld a, [hl+]", { A = read8(HL); ++HL; })
 INS(0x2b, _,_,_,_, 1, 8 , "dec hl", { --HL; })
 INS(0x2c, Z,0,H,_, 1, 4 , "inc l", { L = inc8(L); })
 INS(0x2d, Z,1,H,_, 1, 4 , "dec l", { L = dec8(L); })
-INS(0x2e, _,_,_,_, 2, 8 , "ld l, n8", { L = rd8(PC); })
+INS(0x2e, _,_,_,_, 2, 8 , "ld l, n8", { L = IMM8; })
 INS(0x2f, _,1,1,_, 1, 4 , "cpl", { A = ~A; })
 INS(0x30, _,_,_,_, 2, 8 + 4, "jr nc, e8", {
     // 3 cycles when taken, 2 when not taken
-    int8_t offset = static_cast<int8_t>(rd8(PC));
+    int8_t offset = static_cast<int8_t>(IMM8);
     if (! state_.flagC())
         PC += offset;
     else
         cycles_ -= 4;
 })
-INS(0x31, _,_,_,_, 3, 12, "ld sp, n16", { SP = rd16(PC); })
+INS(0x31, _,_,_,_, 3, 12, "ld sp, n16", { SP = IMM16; })
 INS(0x32, _,_,_,_, 1, 8 , "ld [hl-], a", { write8(HL, A); --HL; })
 INS(0x33, _,_,_,_, 1, 8 , "inc sp", { ++SP; })
 INS(0x34, Z,0,H,_, 1, 12, "inc [hl]", { write8(HL, inc8(read8(HL))); })
 INS(0x35, Z,1,H,_, 1, 12, "dec [hl]", { write8(HL, dec8(read8(HL))); })
-INS(0x36, _,_,_,_, 2, 12, "ld [hl], n8", { write8(HL, rd8(PC)); })
+INS(0x36, _,_,_,_, 2, 12, "ld [hl], n8", { write8(HL, IMM8); })
 /** Simply sets the carry flag, already handled by the macro expansion in the emulator loop. 
  */
 INS(0x37, _,0,0,1, 1, 4 , "scf", {})
 INS(0x38, _,_,_,_, 2, 8 + 4, "jr c, e8", {
     // 3 cycles when taken, 2 when not taken
-    int8_t offset = static_cast<int8_t>(rd8(PC));
+    int8_t offset = static_cast<int8_t>(IMM8);
     if (state_.flagC())
         PC += offset;
     else
@@ -127,7 +127,7 @@ INS(0x3a, _,_,_,_, 1, 8 , "ld a, [hl-]", { A = read8(HL); --HL; })
 INS(0x3b, _,_,_,_, 1, 8 , "dec sp", { --SP; })
 INS(0x3c, Z,0,H,_, 1, 4 , "inc a", { A = inc8(A); })
 INS(0x3d, Z,1,H,_, 1, 4 , "dec a", { A = dec8(A); })
-INS(0x3e, _,_,_,_, 2, 8 , "ld a, n8", { A = rd8(PC); })
+INS(0x3e, _,_,_,_, 2, 8 , "ld a, n8", { A = IMM8; })
 INS(0x3f, _,0,0,C, 1, 4 , "ccf", { state_.setFlagC(!state_.flagC()); })
 /** Loads register into itself. This is effectively a no-op.
  */
@@ -230,29 +230,29 @@ INS(0x9d, Z,1,H,C, 1, 4 , "sbc a, l", { A = sub8(A, L, state_.flagC()); })
 INS(0x9e, Z,1,H,C, 1, 8 , "sbc a, [hl]", { A = sub8(A, read8(HL), state_.flagC()); })
 INS(0x9f, Z,1,H,_, 1, 4 , "sbc a, a", { A = sub8(A, A, state_.flagC()); })
 INS(0xa0, Z,0,1,0, 1, 4 , "and a, b", { state_.setFlagZFrom(A = A & B); })
-INS(0xa1, Z,0,1,0, 1, 4 , "and a, c", { A = A & C; state_.setFlagZ(A == 0); })
-INS(0xa2, Z,0,1,0, 1, 4 , "and a, d", { A = A & D; state_.setFlagZ(A == 0); })
-INS(0xa3, Z,0,1,0, 1, 4 , "and a, e", { A = A & E; state_.setFlagZ(A == 0); })
-INS(0xa4, Z,0,1,0, 1, 4 , "and a, h", { A = A & H; state_.setFlagZ(A == 0); })
-INS(0xa5, Z,0,1,0, 1, 4 , "and a, l", { A = A & L; state_.setFlagZ(A == 0); })
-INS(0xa6, Z,0,1,0, 1, 8 , "and a, [hl]", { A = A & read8(HL); state_.setFlagZ(A == 0); })
-INS(0xa7, Z,0,1,0, 1, 4 , "and a, a", { A = A & A; state_.setFlagZ(A == 0); })
-INS(0xa8, Z,0,0,0, 1, 4 , "xor a, b", { A = A ^ B; state_.setFlagZ(A == 0); })
-INS(0xa9, Z,0,0,0, 1, 4 , "xor a, c", { A = A ^ C; state_.setFlagZ(A == 0); })
-INS(0xaa, Z,0,0,0, 1, 4 , "xor a, d", { A = A ^ D; state_.setFlagZ(A == 0); })
-INS(0xab, Z,0,0,0, 1, 4 , "xor a, e", { A = A ^ E; state_.setFlagZ(A == 0); })
-INS(0xac, Z,0,0,0, 1, 4 , "xor a, h", { A = A ^ H; state_.setFlagZ(A == 0); })
-INS(0xad, Z,0,0,0, 1, 4 , "xor a, l", { A = A ^ L; state_.setFlagZ(A == 0); })
-INS(0xae, Z,0,0,0, 1, 8 , "xor a, [hl]", { A = A ^ read8(HL); state_.setFlagZ(A == 0); })
-INS(0xaf, 1,0,0,0, 1, 4 , "xor a, a", {  A =  A | A; })
-INS(0xb0, Z,0,0,0, 1, 4 , "or a, b", { A = A | B; state_.setFlagZ(A == 0); })
-INS(0xb1, Z,0,0,0, 1, 4 , "or a, c", { A = A | C; state_.setFlagZ(A == 0); })
-INS(0xb2, Z,0,0,0, 1, 4 , "or a, d", { A = A | D; state_.setFlagZ(A == 0); })
-INS(0xb3, Z,0,0,0, 1, 4 , "or a, e", { A = A | E; state_.setFlagZ(A == 0); })
-INS(0xb4, Z,0,0,0, 1, 4 , "or a, h", { A = A | H; state_.setFlagZ(A == 0); })
-INS(0xb5, Z,0,0,0, 1, 4 , "or a, l", { A = A | L; state_.setFlagZ(A == 0); })
-INS(0xb6, Z,0,0,0, 1, 8 , "or a, [hl]", { A = A | read8(HL); state_.setFlagZ(A == 0); })
-INS(0xb7, Z,0,0,0, 1, 4 , "or a, a", { A = A | A; state_.setFlagZ(A == 0); })
+INS(0xa1, Z,0,1,0, 1, 4 , "and a, c", { state_.setFlagZFrom(A = A & C); })
+INS(0xa2, Z,0,1,0, 1, 4 , "and a, d", { state_.setFlagZFrom(A = A & D); })
+INS(0xa3, Z,0,1,0, 1, 4 , "and a, e", { state_.setFlagZFrom(A = A & E); })
+INS(0xa4, Z,0,1,0, 1, 4 , "and a, h", { state_.setFlagZFrom(A = A & H); })
+INS(0xa5, Z,0,1,0, 1, 4 , "and a, l", { state_.setFlagZFrom(A = A & L); })
+INS(0xa6, Z,0,1,0, 1, 8 , "and a, [hl]", { state_.setFlagZFrom(A = A & read8(HL)); })
+INS(0xa7, Z,0,1,0, 1, 4 , "and a, a", { state_.setFlagZFrom(A = A & A); })
+INS(0xa8, Z,0,0,0, 1, 4 , "xor a, b", { state_.setFlagZFrom(A = A ^ B); })
+INS(0xa9, Z,0,0,0, 1, 4 , "xor a, c", { state_.setFlagZFrom(A = A ^ C); })
+INS(0xaa, Z,0,0,0, 1, 4 , "xor a, d", { state_.setFlagZFrom(A = A ^ D); })
+INS(0xab, Z,0,0,0, 1, 4 , "xor a, e", { state_.setFlagZFrom(A = A ^ E); })
+INS(0xac, Z,0,0,0, 1, 4 , "xor a, h", { state_.setFlagZFrom(A = A ^ H); })
+INS(0xad, Z,0,0,0, 1, 4 , "xor a, l", { state_.setFlagZFrom(A = A ^ L); })
+INS(0xae, Z,0,0,0, 1, 8 , "xor a, [hl]", { state_.setFlagZFrom(A = A ^ read8(HL)); })
+INS(0xaf, 1,0,0,0, 1, 4 , "xor a, a", { A = 0; })
+INS(0xb0, Z,0,0,0, 1, 4 , "or a, b", { state_.setFlagZFrom(A = A | B); })
+INS(0xb1, Z,0,0,0, 1, 4 , "or a, c", { state_.setFlagZFrom(A = A | C); })
+INS(0xb2, Z,0,0,0, 1, 4 , "or a, d", { state_.setFlagZFrom(A = A | D); })
+INS(0xb3, Z,0,0,0, 1, 4 , "or a, e", { state_.setFlagZFrom(A = A | E); })
+INS(0xb4, Z,0,0,0, 1, 4 , "or a, h", { state_.setFlagZFrom(A = A | H); })
+INS(0xb5, Z,0,0,0, 1, 4 , "or a, l", { state_.setFlagZFrom(A = A | L); })
+INS(0xb6, Z,0,0,0, 1, 8 , "or a, [hl]", { state_.setFlagZFrom(A = A | read8(HL)); })
+INS(0xb7, Z,0,0,0, 1, 4 , "or a, a", { state_.setFlagZFrom(A = A | A); })
 INS(0xb8, Z,1,H,C, 1, 4 , "cp a, b", { sub8(A, B); })
 INS(0xb9, Z,1,H,C, 1, 4 , "cp a, c", { sub8(A, C); })
 INS(0xba, Z,1,H,C, 1, 4 , "cp a, d", { sub8(A, D); })
@@ -275,16 +275,16 @@ INS(0xc0, _,_,_,_, 1, 8 + 12, "ret nz", {
 INS(0xc1, _,_,_,_, 1, 12, "pop bc", { BC = read16(SP); SP += 2; })
 INS(0xc2, _,_,_,_, 3, 12 + 4, "jp nz, a16", {
     // 4 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (! state_.flagZ())
         PC = addr;
     else
         cycles_ -= 4;
 })
-INS(0xc3, _,_,_,_, 3, 16, "jp a16", { PC = rd16(PC); })
+INS(0xc3, _,_,_,_, 3, 16, "jp a16", { PC = IMM16; })
 INS(0xc4, _,_,_,_, 3, 12 + 12, "call nz, a16", {
     // 6 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (! state_.flagZ()) {
         SP -= 2;
         write16(SP, PC);
@@ -294,7 +294,7 @@ INS(0xc4, _,_,_,_, 3, 12 + 12, "call nz, a16", {
     }
 })
 INS(0xc5, _,_,_,_, 1, 16, "push bc", { SP -= 2; write16(SP, BC); })
-INS(0xc6, Z,0,H,C, 2, 8 , "add a, n8", { A = add8(A, rd8(PC)); })
+INS(0xc6, Z,0,H,C, 2, 8 , "add a, n8", { A = add8(A, IMM8); })
 INS(0xc7, _,_,_,_, 1, 16, "rst $00", {
     SP -= 2; 
     write16(SP, PC); 
@@ -312,90 +312,18 @@ INS(0xc8, _,_,_,_, 1, 8 + 12, "ret z", {
 INS(0xc9, _,_,_,_, 1, 16, "ret", { PC = read16(SP); SP += 2; })
 INS(0xca, _,_,_,_, 3, 12 + 4, "jp z, a16", {
     // 4 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (state_.flagZ())
         PC = addr;
     else
         cycles_ -= 4;
 })
-/** The prefixed instructions. 
- 
-    The follow a very simple decoding pattern whereas the 3 LSB identify a register (B, C, D, E, H,  L, [HL], A) and the upper 5 bits specify the operation. 
+/** The prefixed instructions, see insns_cb.inc.h. The dispatch loop defines how PREFIX_CB executes them. 
 */
-INS(0xcb, _,_,_,_, 1, 4 , "prefix", {
-    uint8_t eo = rd8(PC); 
-    uint8_t reg = eo & 7;
-    eo = eo >> 3;
-    uint8_t r;
-    switch (reg) {
-        case 0: r = B; break;
-        case 1: r = C; break;
-        case 2: r = D; break;
-        case 3: r = E; break;
-        case 4: r = H; break;
-        case 5: r = L; break;
-        case 6: r = read8(HL); break;
-        default:
-        case 7: r = A; break;
-    }
-    switch (eo) {
-        case 0: // RLC
-            r = rlc8(r);
-            break;
-        case 1: // RRC
-            r = rrc8(r);
-            break;
-        case 2: // RL
-            r = rl8(r);
-            break;
-        case 3: // RR
-            r = rr8(r);
-            break;
-        case 4: // SLA
-            r = sla8(r);
-            break;
-        case 5: // SRA
-            r = sra8(r);
-            break;
-        case 6: // SWAP
-            eo = r & 0xf;
-            r = (eo << 4) | (r >> 4);
-            break;
-        case 7: // SRL
-            r = srl8(r);
-            break;
-        default: { // bit operations
-            unsigned bit = eo & 7;
-            eo = eo >> 3;
-            switch (eo) {
-                case 1: // BIT
-                    state_.setFlagZ((r & (1 << bit)) == 0);
-                    state_.setFlagN(0);
-                    state_.setFlagH(0);
-                    break;
-                case 2: // RES
-                    r = r & ~(1 << bit);
-                    break;
-                case 3: // SET
-                    r = r | (1 << bit);
-                    break;
-            }
-        }
-    }
-    switch (reg) {
-        case 0: B = r; break;
-        case 1: C = r; break;
-        case 2: D = r; break;
-        case 3: E = r; break;
-        case 4: H = r; break;
-        case 5: L = r; break;
-        case 6: write8(HL, r); break;
-        case 7: A = r; break;
-    }
-})
+INS(0xcb, _,_,_,_, 2, 4 , "prefix", { PREFIX_CB(IMM8); })
 INS(0xcc, _,_,_,_, 3, 12 + 12, "call z, a16", {
     // 6 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (state_.flagZ()) {
         SP -= 2;
         write16(SP, PC);
@@ -405,12 +333,12 @@ INS(0xcc, _,_,_,_, 3, 12 + 12, "call z, a16", {
     }
 })
 INS(0xcd, _,_,_,_, 3, 24, "call a16", {
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     SP -= 2;
     write16(SP, PC);
     PC = addr;
 })
-INS(0xce, Z,0,H,C, 2, 8 , "adc a, n8", { A = add8(A, rd8(PC), state_.flagC()); })
+INS(0xce, Z,0,H,C, 2, 8 , "adc a, n8", { A = add8(A, IMM8, state_.flagC()); })
 INS(0xcf, _,_,_,_, 1, 16, "rst $08", {
     SP -= 2; 
     write16(SP, PC); 
@@ -428,7 +356,7 @@ INS(0xd0, _,_,_,_, 1, 8 + 12, "ret nc", {
 INS(0xd1, _,_,_,_, 1, 12, "pop de", { DE = read16(SP); SP += 2; })
 INS(0xd2, _,_,_,_, 3, 12 + 4, "jp nc, a16", {
     // 4 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (! state_.flagC())
         PC = addr;
     else
@@ -436,7 +364,7 @@ INS(0xd2, _,_,_,_, 3, 12 + 4, "jp nc, a16", {
 })
 INS(0xd4, _,_,_,_, 3, 12 + 12, "call nc, a16", {
     // 6 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (! state_.flagC()) {
         SP -= 2;
         write16(SP, PC);
@@ -446,7 +374,7 @@ INS(0xd4, _,_,_,_, 3, 12 + 12, "call nc, a16", {
     }
 })
 INS(0xd5, _,_,_,_, 1, 16, "push de", { SP -= 2; write16(SP, DE); })
-INS(0xd6, Z,1,H,C, 2, 8 , "sub a, n8", { A = sub8(A, rd8(PC)); })
+INS(0xd6, Z,1,H,C, 2, 8 , "sub a, n8", { A = sub8(A, IMM8); })
 INS(0xd7, _,_,_,_, 1, 16, "rst $10", {
     SP -= 2; 
     write16(SP, PC); 
@@ -468,7 +396,7 @@ INS(0xd9, _,_,_,_, 1, 16, "reti", {
 })
 INS(0xda, _,_,_,_, 3, 12 + 4, "jp c, a16", {
     // 4 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (state_.flagC())
         PC = addr;
     else
@@ -476,7 +404,7 @@ INS(0xda, _,_,_,_, 3, 12 + 4, "jp c, a16", {
 })
 INS(0xdc, _,_,_,_, 3, 12 + 12, "call c, a16", {
     // 6 cycles taken, 3 cycles not taken
-    uint16_t addr = rd16(PC);
+    uint16_t addr = IMM16;
     if (state_.flagC()) {
         SP -= 2;
         write16(SP, PC);
@@ -485,17 +413,17 @@ INS(0xdc, _,_,_,_, 3, 12 + 12, "call c, a16", {
         cycles_ -= 12;
     }
 })
-INS(0xde, Z,1,H,C, 2, 8 , "sbc a, n8", { A = sub8(A, rd8(PC), state_.flagC()); })
+INS(0xde, Z,1,H,C, 2, 8 , "sbc a, n8", { A = sub8(A, IMM8, state_.flagC()); })
 INS(0xdf, _,_,_,_, 1, 16, "rst $18", {
     SP -= 2; 
     write16(SP, PC); 
     PC = 0x18; 
 })
-INS(0xe0, _,_,_,_, 2, 12, "ldh [a8], a", { write8(0xff00 + rd8(PC), A); })
+INS(0xe0, _,_,_,_, 2, 12, "ldh [a8], a", { write8(0xff00 + IMM8, A); })
 INS(0xe1, _,_,_,_, 1, 12, "pop hl", { HL = read8(SP); SP += 2; })
 INS(0xe2, _,_,_,_, 1, 8 , "ld [c], a", {  write8(0xff00 + C, A); })
 INS(0xe5, _,_,_,_, 1, 16, "push hl", { SP -= 2; write16(SP, HL); })
-INS(0xe6, Z,0,1,0, 2, 8 , "and a, n8", { A = A & rd8(PC); state_.setFlagZ(A == 0); })
+INS(0xe6, Z,0,1,0, 2, 8 , "and a, n8", { state_.setFlagZFrom(A = A & IMM8); })
 INS(0xe7, _,_,_,_, 1, 16, "rst $20", {
     SP -= 2; 
     write16(SP, PC); 
@@ -505,35 +433,40 @@ INS(0xe8, 0,0,H,C, 2, 16, "add sp, e8", {
     UNIMPLEMENTED;
 })
 INS(0xe9, _,_,_,_, 1, 4 , "jp hl", { PC = HL; })
-INS(0xea, _,_,_,_, 3, 16, "ld [a16], a", { write8(rd16(PC), A); })
-INS(0xee, Z,0,0,0, 2, 8 , "xor a, n8", { A = A ^ rd8(PC); state_.setFlagZ(A == 0); })
+INS(0xea, _,_,_,_, 3, 16, "ld [a16], a", { write8(IMM16, A); })
+INS(0xee, Z,0,0,0, 2, 8 , "xor a, n8", { state_.setFlagZFrom(A = A ^ IMM8); })
 INS(0xef, _,_,_,_, 1, 16, "rst $28", {
     SP -= 2; 
     write16(SP, PC); 
     PC = 0x28; 
 })
-INS(0xf0, _,_,_,_, 2, 12, "ldh a, [a8]", { A = read8(0xff00 + rd8(PC)); })
-INS(0xf1, Z,N,H,C, 1, 12, "pop af", { AF = read8(SP); SP += 2; })
+INS(0xf0, _,_,_,_, 2, 12, "ldh a, [a8]", { A = read8(0xff00 + IMM8); })
+INS(0xf1, Z,N,H,C, 1, 12, "pop af", { 
+    uint16_t value = read16(SP);
+    SP += 2;
+    A = value >> 8;
+    state_.setF(value & 0xff);
+})
 INS(0xf2, _,_,_,_, 1, 8 , "ld a, [c]", { A = read8(0xff00 + C); })
 INS(0xf3, _,_,_,_, 1, 4 , "di", { ime_ = false; })
-INS(0xf5, _,_,_,_, 1, 16, "push af", { SP -= 2; write16(SP, AF); })
-INS(0xf6, Z,0,0,0, 2, 8 , "or a, n8", { A = A | rd8(PC); state_.setFlagZ(A == 0); })
+INS(0xf5, _,_,_,_, 1, 16, "push af", { SP -= 2; write16(SP, state_.af()); })
+INS(0xf6, Z,0,0,0, 2, 8 , "or a, n8", { state_.setFlagZFrom(A = A | IMM8); })
 INS(0xf7, _,_,_,_, 1, 16, "rst $30", { 
     SP -= 2; 
     write16(SP, PC); 
     PC = 0x30; 
 })
 INS(0xf8, 0,0,H,C, 2, 12, "ld hl, sp, e8", { 
-    int8_t imm = static_cast<int8_t>(rd8(PC));
+    int8_t imm = static_cast<int8_t>(IMM8);
     HL = SP + imm;
     // a bit weird, but internet suggests this is actually what the instruction does
     state_.setFlagH((SP & 0xf) + (imm & 0xf) > 0xf);
     state_.setFlagC((SP & 0xff) + (imm & 0xff) > 0xff);
 })
 INS(0xf9, _,_,_,_, 1, 8 , "ld sp, hl", { SP = HL; })
-INS(0xfa, _,_,_,_, 3, 16, "ld a, [a16]", { A = rd16(PC); })
+INS(0xfa, _,_,_,_, 3, 16, "ld a, [a16]", { A = IMM16; })
 INS(0xfb, _,_,_,_, 1, 4 , "ei", { ime_ = true; })
-INS(0xfe, Z,1,H,C, 2, 8 , "cp a, n8", { sub8(A, rd8(PC)); })
+INS(0xfe, Z,1,H,C, 2, 8 , "cp a, n8", { sub8(A, IMM8); })
 INS(0xff, _,_,_,_, 1, 16, "rst $38", { 
     SP -= 2; 
     write16(SP, PC); 
@@ -0,0 +1,262 @@
+/** The 0xcb prefixed instructions. 
+
+    Their second byte identifies the register in its 3 LSB (B, C, D, E, H, L, [HL], A) and the operation in the upper 5 bits. The rotations, shifts and swap set the Z flag from the result and clear N and H, BIT sets Z if the bit is clear, clears N and sets H, RES and SET do not change the flags. 
+    
+    The cycles are in addition to the 4 cycles of the prefix itself. 
+ */
+CB(0x00, Z,0,0,C, 4 , "rlc b", { B = rlc8(B); })
+CB(0x01, Z,0,0,C, 4 , "rlc c", { C = rlc8(C); })
+CB(0x02, Z,0,0,C, 4 , "rlc d", { D = rlc8(D); })
+CB(0x03, Z,0,0,C, 4 , "rlc e", { E = rlc8(E); })
+CB(0x04, Z,0,0,C, 4 , "rlc h", { H = rlc8(H); })
+CB(0x05, Z,0,0,C, 4 , "rlc l", { L = rlc8(L); })
+CB(0x06, Z,0,0,C, 12, "rlc [hl]", { write8(HL, rlc8(read8(HL))); })
+CB(0x07, Z,0,0,C, 4 , "rlc a", { A = rlc8(A); })
+CB(0x08, Z,0,0,C, 4 , "rrc b", { B = rrc8(B); })
+CB(0x09, Z,0,0,C, 4 , "rrc c", { C = rrc8(C); })
+CB(0x0a, Z,0,0,C, 4 , "rrc d", { D = rrc8(D); })
+CB(0x0b, Z,0,0,C, 4 , "rrc e", { E = rrc8(E); })
+CB(0x0c, Z,0,0,C, 4 , "rrc h", { H = rrc8(H); })
+CB(0x0d, Z,0,0,C, 4 , "rrc l", { L = rrc8(L); })
+CB(0x0e, Z,0,0,C, 12, "rrc [hl]", { write8(HL, rrc8(read8(HL))); })
+CB(0x0f, Z,0,0,C, 4 , "rrc a", { A = rrc8(A); })
+CB(0x10, Z,0,0,C, 4 , "rl b", { B = rl8(B); })
+CB(0x11, Z,0,0,C, 4 , "rl c", { C = rl8(C); })
+CB(0x12, Z,0,0,C, 4 , "rl d", { D = rl8(D); })
+CB(0x13, Z,0,0,C, 4 , "rl e", { E = rl8(E); })
+CB(0x14, Z,0,0,C, 4 , "rl h", { H = rl8(H); })
+CB(0x15, Z,0,0,C, 4 , "rl l", { L = rl8(L); })
+CB(0x16, Z,0,0,C, 12, "rl [hl]", { write8(HL, rl8(read8(HL))); })
+CB(0x17, Z,0,0,C, 4 , "rl a", { A = rl8(A); })
+CB(0x18, Z,0,0,C, 4 , "rr b", { B = rr8(B); })
+CB(0x19, Z,0,0,C, 4 , "rr c", { C = rr8(C); })
+CB(0x1a, Z,0,0,C, 4 , "rr d", { D = rr8(D); })
+CB(0x1b, Z,0,0,C, 4 , "rr e", { E = rr8(E); })
+CB(0x1c, Z,0,0,C, 4 , "rr h", { H = rr8(H); })
+CB(0x1d, Z,0,0,C, 4 , "rr l", { L = rr8(L); })
+CB(0x1e, Z,0,0,C, 12, "rr [hl]", { write8(HL, rr8(read8(HL))); })
+CB(0x1f, Z,0,0,C, 4 , "rr a", { A = rr8(A); })
+CB(0x20, Z,0,0,C, 4 , "sla b", { B = sla8(B); })
+CB(0x21, Z,0,0,C, 4 , "sla c", { C = sla8(C); })
+CB(0x22, Z,0,0,C, 4 , "sla d", { D = sla8(D); })
+CB(0x23, Z,0,0,C, 4 , "sla e", { E = sla8(E); })
+CB(0x24, Z,0,0,C, 4 , "sla h", { H = sla8(H); })
+CB(0x25, Z,0,0,C, 4 , "sla l", { L = sla8(L); })
+CB(0x26, Z,0,0,C, 12, "sla [hl]", { write8(HL, sla8(read8(HL))); })
+CB(0x27, Z,0,0,C, 4 , "sla a", { A = sla8(A); })
+CB(0x28, Z,0,0,C, 4 , "sra b", { B = sra8(B); })
+CB(0x29, Z,0,0,C, 4 , "sra c", { C = sra8(C); })
+CB(0x2a, Z,0,0,C, 4 , "sra d", { D = sra8(D); })
+CB(0x2b, Z,0,0,C, 4 , "sra e", { E = sra8(E); })
+CB(0x2c, Z,0,0,C, 4 , "sra h", { H = sra8(H); })
+CB(0x2d, Z,0,0,C, 4 , "sra l", { L = sra8(L); })
+CB(0x2e, Z,0,0,C, 12, "sra [hl]", { write8(HL, sra8(read8(HL))); })
+CB(0x2f, Z,0,0,C, 4 , "sra a", { A = sra8(A); })
+CB(0x30, Z,0,0,0, 4 , "swap b", { B = swap8(B); })
+CB(0x31, Z,0,0,0, 4 , "swap c", { C = swap8(C); })
+CB(0x32, Z,0,0,0, 4 , "swap d", { D = swap8(D); })
+CB(0x33, Z,0,0,0, 4 , "swap e", { E = swap8(E); })
+CB(0x34, Z,0,0,0, 4 , "swap h", { H = swap8(H); })
+CB(0x35, Z,0,0,0, 4 , "swap l", { L = swap8(L); })
+CB(0x36, Z,0,0,0, 12, "swap [hl]", { write8(HL, swap8(read8(HL))); })
+CB(0x37, Z,0,0,0, 4 , "swap a", { A = swap8(A); })
+CB(0x38, Z,0,0,C, 4 , "srl b", { B = srl8(B); })
+CB(0x39, Z,0,0,C, 4 , "srl c", { C = srl8(C); })
+CB(0x3a, Z,0,0,C, 4 , "srl d", { D = srl8(D); })
+CB(0x3b, Z,0,0,C, 4 , "srl e", { E = srl8(E); })
+CB(0x3c, Z,0,0,C, 4 , "srl h", { H = srl8(H); })
+CB(0x3d, Z,0,0,C, 4 , "srl l", { L = srl8(L); })
+CB(0x3e, Z,0,0,C, 12, "srl [hl]", { write8(HL, srl8(read8(HL))); })
+CB(0x3f, Z,0,0,C, 4 , "srl a", { A = srl8(A); })
+CB(0x40, Z,0,1,_, 4 , "bit 0, b", { state_.setFlagZFrom(B & (1 << 0)); })
+CB(0x41, Z,0,1,_, 4 , "bit 0, c", { state_.setFlagZFrom(C & (1 << 0)); })
+CB(0x42, Z,0,1,_, 4 , "bit 0, d", { state_.setFlagZFrom(D & (1 << 0)); })
+CB(0x43, Z,0,1,_, 4 , "bit 0, e", { state_.setFlagZFrom(E & (1 << 0)); })
+CB(0x44, Z,0,1,_, 4 , "bit 0, h", { state_.setFlagZFrom(H & (1 << 0)); })
+CB(0x45, Z,0,1,_, 4 , "bit 0, l", { state_.setFlagZFrom(L & (1 << 0)); })
+CB(0x46, Z,0,1,_, 8 , "bit 0, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 0)); })
+CB(0x47, Z,0,1,_, 4 , "bit 0, a", { state_.setFlagZFrom(A & (1 << 0)); })
+CB(0x48, Z,0,1,_, 4 , "bit 1, b", { state_.setFlagZFrom(B & (1 << 1)); })
+CB(0x49, Z,0,1,_, 4 , "bit 1, c", { state_.setFlagZFrom(C & (1 << 1)); })
+CB(0x4a, Z,0,1,_, 4 , "bit 1, d", { state_.setFlagZFrom(D & (1 << 1)); })
+CB(0x4b, Z,0,1,_, 4 , "bit 1, e", { state_.setFlagZFrom(E & (1 << 1)); })
+CB(0x4c, Z,0,1,_, 4 , "bit 1, h", { state_.setFlagZFrom(H & (1 << 1)); })
+CB(0x4d, Z,0,1,_, 4 , "bit 1, l", { state_.setFlagZFrom(L & (1 << 1)); })
+CB(0x4e, Z,0,1,_, 8 , "bit 1, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 1)); })
+CB(0x4f, Z,0,1,_, 4 , "bit 1, a", { state_.setFlagZFrom(A & (1 << 1)); })
+CB(0x50, Z,0,1,_, 4 , "bit 2, b", { state_.setFlagZFrom(B & (1 << 2)); })
+CB(0x51, Z,0,1,_, 4 , "bit 2, c", { state_.setFlagZFrom(C & (1 << 2)); })
+CB(0x52, Z,0,1,_, 4 , "bit 2, d", { state_.setFlagZFrom(D & (1 << 2)); })
+CB(0x53, Z,0,1,_, 4 , "bit 2, e", { state_.setFlagZFrom(E & (1 << 2)); })
+CB(0x54, Z,0,1,_, 4 , "bit 2, h", { state_.setFlagZFrom(H & (1 << 2)); })
+CB(0x55, Z,0,1,_, 4 , "bit 2, l", { state_.setFlagZFrom(L & (1 << 2)); })
+CB(0x56, Z,0,1,_, 8 , "bit 2, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 2)); })
+CB(0x57, Z,0,1,_, 4 , "bit 2, a", { state_.setFlagZFrom(A & (1 << 2)); })
+CB(0x58, Z,0,1,_, 4 , "bit 3, b", { state_.setFlagZFrom(B & (1 << 3)); })
+CB(0x59, Z,0,1,_, 4 , "bit 3, c", { state_.setFlagZFrom(C & (1 << 3)); })
+CB(0x5a, Z,0,1,_, 4 , "bit 3, d", { state_.setFlagZFrom(D & (1 << 3)); })
+CB(0x5b, Z,0,1,_, 4 , "bit 3, e", { state_.setFlagZFrom(E & (1 << 3)); })
+CB(0x5c, Z,0,1,_, 4 , "bit 3, h", { state_.setFlagZFrom(H & (1 << 3)); })
+CB(0x5d, Z,0,1,_, 4 , "bit 3, l", { state_.setFlagZFrom(L & (1 << 3)); })
+CB(0x5e, Z,0,1,_, 8 , "bit 3, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 3)); })
+CB(0x5f, Z,0,1,_, 4 , "bit 3, a", { state_.setFlagZFrom(A & (1 << 3)); })
+CB(0x60, Z,0,1,_, 4 , "bit 4, b", { state_.setFlagZFrom(B & (1 << 4)); })
+CB(0x61, Z,0,1,_, 4 , "bit 4, c", { state_.setFlagZFrom(C & (1 << 4)); })
+CB(0x62, Z,0,1,_, 4 , "bit 4, d", { state_.setFlagZFrom(D & (1 << 4)); })
+CB(0x63, Z,0,1,_, 4 , "bit 4, e", { state_.setFlagZFrom(E & (1 << 4)); })
+CB(0x64, Z,0,1,_, 4 , "bit 4, h", { state_.setFlagZFrom(H & (1 << 4)); })
+CB(0x65, Z,0,1,_, 4 , "bit 4, l", { state_.setFlagZFrom(L & (1 << 4)); })
+CB(0x66, Z,0,1,_, 8 , "bit 4, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 4)); })
+CB(0x67, Z,0,1,_, 4 , "bit 4, a", { state_.setFlagZFrom(A & (1 << 4)); })
+CB(0x68, Z,0,1,_, 4 , "bit 5, b", { state_.setFlagZFrom(B & (1 << 5)); })
+CB(0x69, Z,0,1,_, 4 , "bit 5, c", { state_.setFlagZFrom(C & (1 << 5)); })
+CB(0x6a, Z,0,1,_, 4 , "bit 5, d", { state_.setFlagZFrom(D & (1 << 5)); })
+CB(0x6b, Z,0,1,_, 4 , "bit 5, e", { state_.setFlagZFrom(E & (1 << 5)); })
+CB(0x6c, Z,0,1,_, 4 , "bit 5, h", { state_.setFlagZFrom(H & (1 << 5)); })
+CB(0x6d, Z,0,1,_, 4 , "bit 5, l", { state_.setFlagZFrom(L & (1 << 5)); })
+CB(0x6e, Z,0,1,_, 8 , "bit 5, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 5)); })
+CB(0x6f, Z,0,1,_, 4 , "bit 5, a", { state_.setFlagZFrom(A & (1 << 5)); })
+CB(0x70, Z,0,1,_, 4 , "bit 6, b", { state_.setFlagZFrom(B & (1 << 6)); })
+CB(0x71, Z,0,1,_, 4 , "bit 6, c", { state_.setFlagZFrom(C & (1 << 6)); })
+CB(0x72, Z,0,1,_, 4 , "bit 6, d", { state_.setFlagZFrom(D & (1 << 6)); })
+CB(0x73, Z,0,1,_, 4 , "bit 6, e", { state_.setFlagZFrom(E & (1 << 6)); })
+CB(0x74, Z,0,1,_, 4 , "bit 6, h", { state_.setFlagZFrom(H & (1 << 6)); })
+CB(0x75, Z,0,1,_, 4 , "bit 6, l", { state_.setFlagZFrom(L & (1 << 6)); })
+CB(0x76, Z,0,1,_, 8 , "bit 6, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 6)); })
+CB(0x77, Z,0,1,_, 4 , "bit 6, a", { state_.setFlagZFrom(A & (1 << 6)); })
+CB(0x78, Z,0,1,_, 4 , "bit 7, b", { state_.setFlagZFrom(B & (1 << 7)); })
+CB(0x79, Z,0,1,_, 4 , "bit 7, c", { state_.setFlagZFrom(C & (1 << 7)); })
+CB(0x7a, Z,0,1,_, 4 , "bit 7, d", { state_.setFlagZFrom(D & (1 << 7)); })
+CB(0x7b, Z,0,1,_, 4 , "bit 7, e", { state_.setFlagZFrom(E & (1 << 7)); })
+CB(0x7c, Z,0,1,_, 4 , "bit 7, h", { state_.setFlagZFrom(H & (1 << 7)); })
+CB(0x7d, Z,0,1,_, 4 , "bit 7, l", { state_.setFlagZFrom(L & (1 << 7)); })
+CB(0x7e, Z,0,1,_, 8 , "bit 7, [hl]", { state_.setFlagZFrom(read8(HL) & (1 << 7)); })
+CB(0x7f, Z,0,1,_, 4 , "bit 7, a", { state_.setFlagZFrom(A & (1 << 7)); })
+CB(0x80, _,_,_,_, 4 , "res 0, b", { B &= ~(1 << 0); })
+CB(0x81, _,_,_,_, 4 , "res 0, c", { C &= ~(1 << 0); })
+CB(0x82, _,_,_,_, 4 , "res 0, d", { D &= ~(1 << 0); })
+CB(0x83, _,_,_,_, 4 , "res 0, e", { E &= ~(1 << 0); })
+CB(0x84, _,_,_,_, 4 , "res 0, h", { H &= ~(1 << 0); })
+CB(0x85, _,_,_,_, 4 , "res 0, l", { L &= ~(1 << 0); })
+CB(0x86, _,_,_,_, 12, "res 0, [hl]", { write8(HL, read8(HL) & ~(1 << 0)); })
+CB(0x87, _,_,_,_, 4 , "res 0, a", { A &= ~(1 << 0); })
+CB(0x88, _,_,_,_, 4 , "res 1, b", { B &= ~(1 << 1); })
+CB(0x89, _,_,_,_, 4 , "res 1, c", { C &= ~(1 << 1); })
+CB(0x8a, _,_,_,_, 4 , "res 1, d", { D &= ~(1 << 1); })
+CB(0x8b, _,_,_,_, 4 , "res 1, e", { E &= ~(1 << 1); })
+CB(0x8c, _,_,_,_, 4 , "res 1, h", { H &= ~(1 << 1); })
+CB(0x8d, _,_,_,_, 4 , "res 1, l", { L &= ~(1 << 1); })
+CB(0x8e, _,_,_,_, 12, "res 1, [hl]", { write8(HL, read8(HL) & ~(1 << 1)); })
+CB(0x8f, _,_,_,_, 4 , "res 1, a", { A &= ~(1 << 1); })
+CB(0x90, _,_,_,_, 4 , "res 2, b", { B &= ~(1 << 2); })
+CB(0x91, _,_,_,_, 4 , "res 2, c", { C &= ~(1 << 2); })
+CB(0x92, _,_,_,_, 4 , "res 2, d", { D &= ~(1 << 2); })
+CB(0x93, _,_,_,_, 4 , "res 2, e", { E &= ~(1 << 2); })
+CB(0x94, _,_,_,_, 4 , "res 2, h", { H &= ~(1 << 2); })
+CB(0x95, _,_,_,_, 4 , "res 2, l", { L &= ~(1 << 2); })
+CB(0x96, _,_,_,_, 12, "res 2, [hl]", { write8(HL, read8(HL) & ~(1 << 2)); })
+CB(0x97, _,_,_,_, 4 , "res 2, a", { A &= ~(1 << 2); })
+CB(0x98, _,_,_,_, 4 , "res 3, b", { B &= ~(1 << 3); })
+CB(0x99, _,_,_,_, 4 , "res 3, c", { C &= ~(1 << 3); })
+CB(0x9a, _,_,_,_, 4 , "res 3, d", { D &= ~(1 << 3); })
+CB(0x9b, _,_,_,_, 4 , "res 3, e", { E &= ~(1 << 3); })
+CB(0x9c, _,_,_,_, 4 , "res 3, h", { H &= ~(1 << 3); })
+CB(0x9d, _,_,_,_, 4 , "res 3, l", { L &= ~(1 << 3); })
+CB(0x9e, _,_,_,_, 12, "res 3, [hl]", { write8(HL, read8(HL) & ~(1 << 3)); })
+CB(0x9f, _,_,_,_, 4 , "res 3, a", { A &= ~(1 << 3); })
+CB(0xa0, _,_,_,_, 4 , "res 4, b", { B &= ~(1 << 4); })
+CB(0xa1, _,_,_,_, 4 , "res 4, c", { C &= ~(1 << 4); })
+CB(0xa2, _,_,_,_, 4 , "res 4, d", { D &= ~(1 << 4); })
+CB(0xa3, _,_,_,_, 4 , "res 4, e", { E &= ~(1 << 4); })
+CB(0xa4, _,_,_,_, 4 , "res 4, h", { H &= ~(1 << 4); })
+CB(0xa5, _,_,_,_, 4 , "res 4, l", { L &= ~(1 << 4); })
+CB(0xa6, _,_,_,_, 12, "res 4, [hl]", { write8(HL, read8(HL) & ~(1 << 4)); })
+CB(0xa7, _,_,_,_, 4 , "res 4, a", { A &= ~(1 << 4); })
+CB(0xa8, _,_,_,_, 4 , "res 5, b", { B &= ~(1 << 5); })
+CB(0xa9, _,_,_,_, 4 , "res 5, c", { C &= ~(1 << 5); })
+CB(0xaa, _,_,_,_, 4 , "res 5, d", { D &= ~(1 << 5); })
+CB(0xab, _,_,_,_, 4 , "res 5, e", { E &= ~(1 << 5); })
+CB(0xac, _,_,_,_, 4 , "res 5, h", { H &= ~(1 << 5); })
+CB(0xad, _,_,_,_, 4 , "res 5, l", { L &= ~(1 << 5); })
+CB(0xae, _,_,_,_, 12, "res 5, [hl]", { write8(HL, read8(HL) & ~(1 << 5)); })
+CB(0xaf, _,_,_,_, 4 , "res 5, a", { A &= ~(1 << 5); })
+CB(0xb0, _,_,_,_, 4 , "res 6, b", { B &= ~(1 << 6); })
+CB(0xb1, _,_,_,_, 4 , "res 6, c", { C &= ~(1 << 6); })
+CB(0xb2, _,_,_,_, 4 , "res 6, d", { D &= ~(1 << 6); })
+CB(0xb3, _,_,_,_, 4 , "res 6, e", { E &= ~(1 << 6); })
+CB(0xb4, _,_,_,_, 4 , "res 6, h", { H &= ~(1 << 6); })
+CB(0xb5, _,_,_,_, 4 , "res 6, l", { L &= ~(1 << 6); })
+CB(0xb6, _,_,_,_, 12, "res 6, [hl]", { write8(HL, read8(HL) & ~(1 << 6)); })
+CB(0xb7, _,_,_,_, 4 , "res 6, a", { A &= ~(1 << 6); })
+CB(0xb8, _,_,_,_, 4 , "res 7, b", { B &= ~(1 << 7); })
+CB(0xb9, _,_,_,_, 4 , "res 7, c", { C &= ~(1 << 7); })
+CB(0xba, _,_,_,_, 4 , "res 7, d", { D &= ~(1 << 7); })
+CB(0xbb, _,_,_,_, 4 , "res 7, e", { E &= ~(1 << 7); })
+CB(0xbc, _,_,_,_, 4 , "res 7, h", { H &= ~(1 << 7); })
+CB(0xbd, _,_,_,_, 4 , "res 7, l", { L &= ~(1 << 7); })
+CB(0xbe, _,_,_,_, 12, "res 7, [hl]", { write8(HL, read8(HL) & ~(1 << 7)); })
+CB(0xbf, _,_,_,_, 4 , "res 7, a", { A &= ~(1 << 7); })
+CB(0xc0, _,_,_,_, 4 , "set 0, b", { B |= (1 << 0); })
+CB(0xc1, _,_,_,_, 4 , "set 0, c", { C |= (1 << 0); })
+CB(0xc2, _,_,_,_, 4 , "set 0, d", { D |= (1 << 0); })
+CB(0xc3, _,_,_,_, 4 , "set 0, e", { E |= (1 << 0); })
+CB(0xc4, _,_,_,_, 4 , "set 0, h", { H |= (1 << 0); })
+CB(0xc5, _,_,_,_, 4 , "set 0, l", { L |= (1 << 0); })
+CB(0xc6, _,_,_,_, 12, "set 0, [hl]", { write8(HL, read8(HL) | (1 << 0)); })
+CB(0xc7, _,_,_,_, 4 , "set 0, a", { A |= (1 << 0); })
+CB(0xc8, _,_,_,_, 4 , "set 1, b", { B |= (1 << 1); })
+CB(0xc9, _,_,_,_, 4 , "set 1, c", { C |= (1 << 1); })
+CB(0xca, _,_,_,_, 4 , "set 1, d", { D |= (1 << 1); })
+CB(0xcb, _,_,_,_, 4 , "set 1, e", { E |= (1 << 1); })
+CB(0xcc, _,_,_,_, 4 , "set 1, h", { H |= (1 << 1); })
+CB(0xcd, _,_,_,_, 4 , "set 1, l", { L |= (1 << 1); })
+CB(0xce, _,_,_,_, 12, "set 1, [hl]", { write8(HL, read8(HL) | (1 << 1)); })
+CB(0xcf, _,_,_,_, 4 , "set 1, a", { A |= (1 << 1); })
+CB(0xd0, _,_,_,_, 4 , "set 2, b", { B |= (1 << 2); })
+CB(0xd1, _,_,_,_, 4 , "set 2, c", { C |= (1 << 2); })
+CB(0xd2, _,_,_,_, 4 , "set 2, d", { D |= (1 << 2); })
+CB(0xd3, _,_,_,_, 4 , "set 2, e", { E |= (1 << 2); })
+CB(0xd4, _,_,_,_, 4 , "set 2, h", { H |= (1 << 2); })
+CB(0xd5, _,_,_,_, 4 , "set 2, l", { L |= (1 << 2); })
+CB(0xd6, _,_,_,_, 12, "set 2, [hl]", { write8(HL, read8(HL) | (1 << 2)); })
+CB(0xd7, _,_,_,_, 4 , "set 2, a", { A |= (1 << 2); })
+CB(0xd8, _,_,_,_, 4 , "set 3, b", { B |= (1 << 3); })
+CB(0xd9, _,_,_,_, 4 , "set 3, c", { C |= (1 << 3); })
+CB(0xda, _,_,_,_, 4 , "set 3, d", { D |= (1 << 3); })
+CB(0xdb, _,_,_,_, 4 , "set 3, e", { E |= (1 << 3); })
+CB(0xdc, _,_,_,_, 4 , "set 3, h", { H |= (1 << 3); })
+CB(0xdd, _,_,_,_, 4 , "set 3, l", { L |= (1 << 3); })
+CB(0xde, _,_,_,_, 12, "set 3, [hl]", { write8(HL, read8(HL) | (1 << 3)); })
+CB(0xdf, _,_,_,_, 4 , "set 3, a", { A |= (1 << 3); })
+CB(0xe0, _,_,_,_, 4 , "set 4, b", { B |= (1 << 4); })
+CB(0xe1, _,_,_,_, 4 , "set 4, c", { C |= (1 << 4); })
+CB(0xe2, _,_,_,_, 4 , "set 4, d", { D |= (1 << 4); })
+CB(0xe3, _,_,_,_, 4 , "set 4, e", { E |= (1 << 4); })
+CB(0xe4, _,_,_,_, 4 , "set 4, h", { H |= (1 << 4); })
+CB(0xe5, _,_,_,_, 4 , "set 4, l", { L |= (1 << 4); })
+CB(0xe6, _,_,_,_, 12, "set 4, [hl]", { write8(HL, read8(HL) | (1 << 4)); })
+CB(0xe7, _,_,_,_, 4 , "set 4, a", { A |= (1 << 4); })
+CB(0xe8, _,_,_,_, 4 , "set 5, b", { B |= (1 << 5); })
+CB(0xe9, _,_,_,_, 4 , "set 5, c", { C |= (1 << 5); })
+CB(0xea, _,_,_,_, 4 , "set 5, d", { D |= (1 << 5); })
+CB(0xeb, _,_,_,_, 4 , "set 5, e", { E |= (1 << 5); })
+CB(0xec, _,_,_,_, 4 , "set 5, h", { H |= (1 << 5); })
+CB(0xed, _,_,_,_, 4 , "set 5, l", { L |= (1 << 5); })
+CB(0xee, _,_,_,_, 12, "set 5, [hl]", { write8(HL, read8(HL) | (1 << 5)); })
+CB(0xef, _,_,_,_, 4 , "set 5, a", { A |= (1 << 5); })
+CB(0xf0, _,_,_,_, 4 , "set 6, b", { B |= (1 << 6); })
+CB(0xf1, _,_,_,_, 4 , "set 6, c", { C |= (1 << 6); })
+CB(0xf2, _,_,_,_, 4 , "set 6, d", { D |= (1 << 6); })
+CB(0xf3, _,_,_,_, 4 , "set 6, e", { E |= (1 << 6); })
+CB(0xf4, _,_,_,_, 4 , "set 6, h", { H |= (1 << 6); })
+CB(0xf5, _,_,_,_, 4 , "set 6, l", { L |= (1 << 6); })
+CB(0xf6, _,_,_,_, 12, "set 6, [hl]", { write8(HL, read8(HL) | (1 << 6)); })
+CB(0xf7, _,_,_,_, 4 , "set 6, a", { A |= (1 << 6); })
+CB(0xf8, _,_,_,_, 4 , "set 7, b", { B |= (1 << 7); })
+CB(0xf9, _,_,_,_, 4 , "set 7, c", { C |= (1 << 7); })
+CB(0xfa, _,_,_,_, 4 , "set 7, d", { D |= (1 << 7); })
+CB(0xfb, _,_,_,_, 4 , "set 7, e", { E |= (1 << 7); })
+CB(0xfc, _,_,_,_, 4 , "set 7, h", { H |= (1 << 7); })
+CB(0xfd, _,_,_,_, 4 , "set 7, l", { L |= (1 << 7); })
+CB(0xfe, _,_,_,_, 12, "set 7, [hl]", { write8(HL, read8(HL) | (1 << 7)); })
+CB(0xff, _,_,_,_, 4 , "set 7, a", { A |= (1 << 7); })
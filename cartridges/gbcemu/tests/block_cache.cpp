@@ -0,0 +1,138 @@
+#include "gbctests.h"
+
+namespace {
+
+    /** Runs the program with the switch dispatch, i.e. without the block cache, and returns the cycles it took.
+     */
+    size_t switchCycles(uint8_t const * pgm, size_t numBytes) {
+        GBC gbc{};
+        gbc.setDispatch(GBC::Dispatch::Switch);
+        gbc.runTest(pgm, numBytes);
+        return gbc.cyclesElapsed();
+    }
+
+}
+
+TEST(gbcemu, blockCache_loop) {
+    GBC gbc{};
+    gbc.setDispatch(GBC::Dispatch::BlockCache);
+    uint8_t const pgm[] = {
+        // 0
+        LD_A_imm8(0),
+        // 2
+        LD_B_imm8(100),
+        // 4
+        INC_A,
+        DEC_B,
+        // 6
+        JR_NZ(4 - 8),
+        // 8
+        STOP(0),
+    };
+    gbc.runTest(pgm, sizeof(pgm));
+    EXPECT(gbc.state().a(), 100);
+    EXPECT(gbc.cyclesElapsed(), switchCycles(pgm, sizeof(pgm)));
+    // the block from the start, the loop block and the stop block are decoded, the loop then runs 98 more times from the cache
+    EXPECT(gbc.blockStats().misses, 3u);
+    EXPECT(gbc.blockStats().hits, 98u);
+    EXPECT(gbc.blockStats().interpreted, 0u);
+}
+
+TEST(gbcemu, blockCache_invalidation) {
+    GBC gbc{};
+    gbc.setDispatch(GBC::Dispatch::BlockCache);
+    uint8_t pgm[] = {
+        LD_A_imm8(1),
+        STOP(0),
+    };
+    gbc.runTest(pgm, sizeof(pgm));
+    EXPECT(gbc.state().a(), 1);
+    // new program at the same address must not run the cached blocks of the old one
+    pgm[1] = 2;
+    gbc.runTest(pgm, sizeof(pgm));
+    EXPECT(gbc.state().a(), 2);
+}
+
+TEST(gbcemu, blockCache_lcdEnableEndsBlock) {
+    GBC gbc{};
+    gbc.setDispatch(GBC::Dispatch::BlockCache);
+    // turns the LCD off, waits and turns it back on, the PPU then has to run while the rest of the block executes
+    uint8_t const pgm[] = {
+        // 0
+        LD_A_imm8(0x11),
+        LDH_ptr8_A(0x40),
+        // 4
+        LD_B_imm8(10),
+        // 6
+        DEC_B,
+        // 7
+        JR_NZ(6 - 9),
+        // 9
+        LD_A_imm8(0x91),
+        LDH_ptr8_A(0x40),
+        LDH_A_ptr8(0x41),
+        LD_C_A,
+        LD_A_ptr16(0xc000),
+        LD_A_ptr16(0xc000),
+        LD_A_ptr16(0xc000),
+        LD_A_ptr16(0xc000),
+        LD_A_ptr16(0xc000),
+        LD_A_ptr16(0xc000),
+        LDH_A_ptr8(0x41),
+        STOP(0),
+    };
+    gbc.runTest(pgm, sizeof(pgm));
+    // the LCD has only just been turned on, i.e. it is in the OAM scan
+    EXPECT(gbc.state().c() & 3, 2);
+    // 112 dots later it is past the OAM scan
+    EXPECT(gbc.state().a() & 3, 3);
+    EXPECT(gbc.cyclesElapsed(), switchCycles(pgm, sizeof(pgm)));
+}
+
+TEST(gbcemu, blockCache_full) {
+    GBC gbc{};
+    gbc.setDispatch(GBC::Dispatch::BlockCache);
+    // more single instruction blocks than fit in the cache, which is then invalidated when full
+    static uint8_t pgm[2100 * 2 + 2];
+    for (size_t i = 0; i < 2100; ++i) {
+        pgm[i * 2] = 0x18; // jr 0
+        pgm[i * 2 + 1] = 0;
+    }
+    pgm[2100 * 2] = 0x10; // stop
+    pgm[2100 * 2 + 1] = 0;
+    gbc.runTest(pgm, sizeof(pgm));
+    EXPECT(gbc.state().pc(), sizeof(pgm));
+    EXPECT(gbc.cyclesElapsed(), 2100 * 12 + 4);
+    EXPECT(gbc.blockStats().misses, 2101u);
+}
+
+TEST(gbcemu, blockCache_bankSwitch) {
+    // three banks, the same address in banks 1 and 2 holds different code, which must not be mixed up when the bank is switched
+    static uint8_t rom[3 * 16 * 1024];
+    uint8_t const main[] = {
+        LD_SP_imm16(0xfffe),
+        LD_A_imm8(2),
+        LD_ptr16_A(0x2000),
+        CALL(0x4000),
+        LD_A_imm8(1),
+        LD_ptr16_A(0x2000),
+        CALL(0x4000),
+        LD_A_imm8(2),
+        LD_ptr16_A(0x2000),
+        CALL(0x4000),
+        STOP(0),
+    };
+    uint8_t const bank1[] = { INC_B, RET };
+    uint8_t const bank2[] = { INC_C, RET };
+    memcpy(rom, main, sizeof(main));
+    memcpy(rom + 16 * 1024, bank1, sizeof(bank1));
+    memcpy(rom + 32 * 1024, bank2, sizeof(bank2));
+    GBC gbc{};
+    gbc.setDispatch(GBC::Dispatch::BlockCache);
+    gbc.runTest(rom, sizeof(rom));
+    EXPECT(gbc.state().b(), 1);
+    EXPECT(gbc.state().c(), 2);
+    // the last call runs the bank 2 block from the cache
+    EXPECT(gbc.blockStats().hits > 0, true);
+    EXPECT(gbc.cyclesElapsed(), switchCycles(rom, sizeof(rom)));
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "gbctests.h"
+
+/** Interpreter dispatch benchmark.
+
+    Runs the workloads with the switch, threaded and block cache dispatch and reports the median time of several repetitions to the standard output, together with the block cache statistics of the whole run. The workloads are the programs of the emulator tests, i.e. the add program of the flags_alu test and the setup program of the PPU tests followed by rendering frames. So that the time is spent in the dispatch and not in the setup, the add program is wrapped in a loop over all its inputs inside the emulated code, and each workload runs as a single program of many instructions. The final state and the number of cycles must be the same for all, so that the benchmark doubles as a test of the threaded dispatch and of the block cache.
+ */
+namespace {
+
+    constexpr int REPETITIONS = 5;
+
+    struct Outcome {
+        uint16_t af;
+        uint16_t bc;
+        uint16_t de;
+        uint16_t hl;
+        uint8_t checksum;
+        size_t cycles;
+
+        bool operator == (Outcome const & other) const {
+            return af == other.af && bc == other.bc && de == other.de && hl == other.hl && checksum == other.checksum && cycles == other.cycles;
+        }
+    };
+
+    Outcome outcome(GBC const & gbc, size_t cycles) {
+        return Outcome{gbc.state().af(), gbc.state().bc(), gbc.state().de(), gbc.state().hl(), gbc.state().wram()[0], cycles};
+    }
+
+    /** The program of the flags_alu test for the add instruction, run for all 65536 combinations of its inputs by the emulated code. The results and flags are summed at 0xc000.
+     */
+    uint8_t const flagsPgm[] = {
+        // 0
+        LD_SP_imm16(0xfffe),
+        // 3
+        LD_HL_imm16(0xc000),
+        // 6
+        LD_D_imm8(0),
+        // 8, for all a
+        LD_E_imm8(0),
+        // 10, for all b, the test program with af = a << 8 | (a & 0xf0)
+        LD_B_D,
+        LD_C_D,
+        PUSH_BC,
+        POP_AF,
+        LD_B_E,
+        ADD_A_B,
+        PUSH_AF,
+        POP_BC,
+        // result and flags go to the checksum
+        LD_A_B,
+        XOR_A_C,
+        ADD_A_ptrHL,
+        LD_ptrHL_A,
+        INC_E,
+        // 23
+        JR_NZ(10 - 25),
+        // 25
+        INC_D,
+        // 26
+        JR_NZ(8 - 28),
+        // 28
+        STOP(0),
+    };
+
+    Outcome runFlags(GBC & gbc) {
+        gbc.runTest(flagsPgm, sizeof(flagsPgm));
+        return outcome(gbc, gbc.cyclesElapsed());
+    }
+
+    /** The setup program of the PPU tests followed by 120 frames.
+     */
+    uint8_t const framesPgm[] = {
+        LD_A_imm8(0x80),
+        LDH_ptr8_A(0x68),
+        LD_A_imm8(0xff),
+        LDH_ptr8_A(0x69),
+        LD_A_imm8(0x7f),
+        LDH_ptr8_A(0x69),
+        STOP(0),
+        JR(-2),
+    };
+
+    Outcome runFrames(GBC & gbc) {
+        static rckid::ColorRGB fb[160 * 144];
+        gbc.setFramebuffer(fb);
+        size_t cycles = 0;
+        for (int i = 0; i < 120; ++i) {
+            gbc.runFrame();
+            cycles += gbc.cyclesElapsed();
+        }
+        gbc.setFramebuffer(nullptr);
+        return outcome(gbc, cycles);
+    }
+
+    void setupFrames(GBC & gbc) {
+        gbc.runTest(framesPgm, sizeof(framesPgm));
+    }
+
+    struct Workload {
+        char const * name;
+        /** Prepares the emulator, not timed.
+         */
+        void (*setup)(GBC &);
+        Outcome (*run)(GBC &);
+    };
+
+    /** Runs the workload with given dispatch REPETITIONS times and returns its outcome, printing the median time and the block cache statistics of the run.
+     */
+    Outcome benchmark(Workload const & workload, char const * dispatchName, GBC::Dispatch dispatch, bool & ok) {
+        std::vector<double> times;
+        Outcome result{};
+        for (int i = 0; i < REPETITIONS; ++i) {
+            GBC gbc{};
+            gbc.setDispatch(dispatch);
+            if (workload.setup != nullptr)
+                workload.setup(gbc);
+            auto start = std::chrono::steady_clock::now();
+            Outcome o = workload.run(gbc);
+            auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            // the repetitions must be the same too
+            if (i > 0 && !(o == result))
+                ok = false;
+            result = o;
+            if (i == REPETITIONS - 1) {
+                std::sort(times.begin(), times.end());
+                std::cout << std::endl << "    " << workload.name << ", " << dispatchName << ": " << times[REPETITIONS / 2] << " ms median of " << REPETITIONS << " (" << times.front() << " - " << times.back() << "), " << result.cycles << " cycles";
+                if (dispatch == GBC::Dispatch::BlockCache) {
+                    GBC::BlockStats const & stats = gbc.blockStats();
+                    std::cout << ", " << stats.hits << " hits, " << stats.misses << " misses, " << stats.interpreted << " interpreted";
+                }
+            }
+        }
+        return result;
+    }
+
+    bool compare(Workload const & workload) {
+        bool ok = true;
+        Outcome switched = benchmark(workload, "switch", GBC::Dispatch::Switch, ok);
+#if GBC_THREADED_DISPATCH
+        ok = (benchmark(workload, "threaded", GBC::Dispatch::Threaded, ok) == switched) && ok;
+#endif
+        return (benchmark(workload, "block cache", GBC::Dispatch::BlockCache, ok) == switched) && ok;
+    }
+
+} // anonymous namespace
+
+TEST(gbcemu, dispatchBenchmark) {
+    EXPECT(compare(Workload{"flags", nullptr, runFlags}));
+    EXPECT(compare(Workload{"frames", setupFrames, runFrames}));
+    std::cout << std::endl;
+}
@@ -0,0 +1,227 @@
+#include "gbctests.h"
+
+/** Exhaustive tests of the lazy flags.
+
+    The instructions that change flags are executed for all values of their 8bit operands and for all incoming flags that matter, and the resulting A register and flags are compared against an eager model, i.e. a straightforward implementation of the instruction that computes the F register directly from the documented behavior. The flags are read both via the state and via push af, which evaluates the F register the same way the emulated code sees it.
+ */
+namespace {
+
+    struct Result {
+        uint8_t a;
+        uint8_t f;
+
+        bool operator == (Result const & other) const { return a == other.a && f == other.f; }
+    };
+
+    uint8_t flag(bool value, uint8_t flag) { return value ? flag : 0; }
+
+    /** Executes the instruction (opcode and an optional second byte) with the A, F and B registers set to given values. Returns the new A and F, or an impossible F if the state and push af disagree.
+     */
+    Result run(GBC & gbc, uint8_t a, uint8_t f, uint8_t b, uint8_t opcode, uint8_t arg = NOP) {
+        uint16_t af = static_cast<uint16_t>((a << 8) | f);
+        uint8_t pgm[] = {
+            LD_SP_imm16(0xfffe),
+            LD_BC_imm16(af),
+            PUSH_BC,
+            POP_AF,
+            LD_B_imm8(b),
+            opcode, arg,
+            PUSH_AF,
+            POP_DE,
+            STOP(0),
+        };
+        runInRom(gbc, pgm, sizeof(pgm));
+        Result result{gbc.state().a(), gbc.state().f()};
+        if (gbc.state().de() != gbc.state().af())
+            result.f = 0xff;
+        return result;
+    }
+
+    enum class Op { Add, Adc, Sub, Sbc, And, Xor, Or, Cp };
+
+    /** The eager model of the 8bit arithmetic and logic instructions.
+     */
+    Result alu(Op op, uint8_t a, uint8_t f, uint8_t b) {
+        unsigned carry = (f & C) ? 1 : 0;
+        switch (op) {
+            case Op::Add:
+            case Op::Adc: {
+                if (op == Op::Add)
+                    carry = 0;
+                unsigned r = a + b + carry;
+                return Result{static_cast<uint8_t>(r), static_cast<uint8_t>(flag((r & 0xff) == 0, Z) | flag((a & 0xf) + (b & 0xf) + carry > 0xf, H) | flag(r > 0xff, C))};
+            }
+            case Op::Sub:
+            case Op::Sbc:
+            case Op::Cp: {
+                if (op != Op::Sbc)
+                    carry = 0;
+                uint8_t r = static_cast<uint8_t>(a - b - carry);
+                uint8_t rf = flag(r == 0, Z) | N | flag((a & 0xf) < (b & 0xf) + carry, H) | flag(a < b + carry, C);
+                return Result{op == Op::Cp ? a : r, rf};
+            }
+            case Op::And:
+                return Result{static_cast<uint8_t>(a & b), static_cast<uint8_t>(flag((a & b) == 0, Z) | H)};
+            case Op::Xor:
+                return Result{static_cast<uint8_t>(a ^ b), flag((a ^ b) == 0, Z)};
+            case Op::Or:
+            default:
+                return Result{static_cast<uint8_t>(a | b), flag((a | b) == 0, Z)};
+        }
+    }
+
+    /** The eager model of the rotations & shifts, both the A register only versions (which always clear Z) and the prefixed ones.
+     */
+    Result shift(uint8_t op, uint8_t a, uint8_t f, bool prefixed) {
+        unsigned carry = (f & C) ? 1 : 0;
+        unsigned r;
+        bool c;
+        switch (op) {
+            case 0: r = (a << 1) | (a >> 7); c = a & 0x80; break; // rlc
+            case 1: r = (a >> 1) | (a << 7); c = a & 1; break; // rrc
+            case 2: r = (a << 1) | carry; c = a & 0x80; break; // rl
+            case 3: r = (a >> 1) | (carry << 7); c = a & 1; break; // rr
+            case 4: r = a << 1; c = a & 0x80; break; // sla
+            case 5: r = (a >> 1) | (a & 0x80); c = a & 1; break; // sra
+            case 6: r = (a << 4) | (a >> 4); c = false; break; // swap
+            default: r = a >> 1; c = a & 1; break; // srl
+        }
+        r &= 0xff;
+        return Result{static_cast<uint8_t>(r), static_cast<uint8_t>(flag(prefixed && r == 0, Z) | flag(c, C))};
+    }
+
+    Result daa(uint8_t a, uint8_t f) {
+        bool c = f & C;
+        if (f & N) {
+            if (c)
+                a -= 0x60;
+            if (f & H)
+                a -= 0x06;
+        } else {
+            if (c || a > 0x99) {
+                a += 0x60;
+                c = true;
+            }
+            if ((f & H) || (a & 0xf) > 0x09)
+                a += 0x06;
+        }
+        return Result{a, static_cast<uint8_t>(flag(a == 0, Z) | (f & N) | flag(c, C))};
+    }
+
+}
+
+TEST(gbcemu, flags_alu) {
+    GBC gbc{};
+    struct { Op op; uint8_t opcode; uint8_t opcodeA; } ops[] = {
+        { Op::Add, ADD_A_B, ADD_A_A },
+        { Op::Adc, ADC_A_B, ADC_A_A },
+        { Op::Sub, SUB_A_B, SUB_A_A },
+        { Op::Sbc, SBC_A_B, SBC_A_A },
+        { Op::And, AND_A_B, AND_A_A },
+        { Op::Xor, XOR_A_B, XOR_A_A },
+        { Op::Or, OR_A_B, OR_A_A },
+        { Op::Cp, CP_A_B, CP_A_A },
+    };
+    unsigned errors = 0;
+    for (auto const & op : ops) {
+        for (unsigned a = 0; a < 256; ++a) {
+            for (unsigned carry = 0; carry < 2; ++carry) {
+                // only the carry flag is an input, the others are set to garbage to check they are overwritten
+                uint8_t f = static_cast<uint8_t>(((a * 0x35) & 0xe0) | (carry ? C : 0));
+                for (unsigned b = 0; b < 256; ++b) {
+                    if (! (run(gbc, a, f, b, op.opcode) == alu(op.op, a, f, b)))
+                        ++errors;
+                }
+                if (! (run(gbc, a, f, 0, op.opcodeA) == alu(op.op, a, f, a)))
+                    ++errors;
+            }
+        }
+    }
+    EXPECT(errors, 0u);
+}
+
+TEST(gbcemu, flags_incDec) {
+    GBC gbc{};
+    unsigned errors = 0;
+    for (unsigned a = 0; a < 256; ++a) {
+        for (unsigned f = 0; f < 256; f += 16) {
+            uint8_t r = static_cast<uint8_t>(a + 1);
+            Result expected{r, static_cast<uint8_t>(flag(r == 0, Z) | flag((a & 0xf) == 0xf, H) | (f & C))};
+            if (! (run(gbc, a, f, 0, INC_A) == expected))
+                ++errors;
+            r = static_cast<uint8_t>(a - 1);
+            expected = Result{r, static_cast<uint8_t>(flag(r == 0, Z) | N | flag((a & 0xf) == 0, H) | (f & C))};
+            if (! (run(gbc, a, f, 0, DEC_A) == expected))
+                ++errors;
+        }
+    }
+    EXPECT(errors, 0u);
+}
+
+TEST(gbcemu, flags_shifts) {
+    GBC gbc{};
+    uint8_t accumulatorOps[] = { RLCA, RRCA, RLA, RRA };
+    unsigned errors = 0;
+    for (unsigned a = 0; a < 256; ++a) {
+        for (unsigned f = 0; f < 256; f += 16) {
+            for (uint8_t op = 0; op < 4; ++op)
+                if (! (run(gbc, a, f, 0, accumulatorOps[op]) == shift(op, a, f, false)))
+                    ++errors;
+            // the prefixed rotations & shifts of the A register are 0xcb, 0x07 + op * 8
+            for (uint8_t op = 0; op < 8; ++op)
+                if (! (run(gbc, a, f, 0, 0xcb, 0x07 + op * 8) == shift(op, a, f, true)))
+                    ++errors;
+            for (uint8_t bit = 0; bit < 8; ++bit) {
+                Result expected{static_cast<uint8_t>(a), static_cast<uint8_t>(flag((a & (1 << bit)) == 0, Z) | H | (f & C))};
+                if (! (run(gbc, a, f, 0, 0xcb, 0x47 + bit * 8) == expected))
+                    ++errors;
+            }
+        }
+    }
+    EXPECT(errors, 0u);
+}
+
+TEST(gbcemu, flags_misc) {
+    GBC gbc{};
+    unsigned errors = 0;
+    for (unsigned a = 0; a < 256; ++a) {
+        for (unsigned f = 0; f < 256; f += 16) {
+            if (! (run(gbc, a, f, 0, DAA) == daa(a, f)))
+                ++errors;
+            if (! (run(gbc, a, f, 0, CPL) == Result{static_cast<uint8_t>(~a), static_cast<uint8_t>((f & (Z | C)) | N | H)}))
+                ++errors;
+            if (! (run(gbc, a, f, 0, SCF) == Result{static_cast<uint8_t>(a), static_cast<uint8_t>((f & Z) | C)}))
+                ++errors;
+            if (! (run(gbc, a, f, 0, CCF) == Result{static_cast<uint8_t>(a), static_cast<uint8_t>((f & Z) | ((f & C) ^ C))}))
+                ++errors;
+        }
+    }
+    EXPECT(errors, 0u);
+}
+
+TEST(gbcemu, flags_add16) {
+    GBC gbc{};
+    unsigned errors = 0;
+    // all combinations are too many, but stepping by primes covers all nibble combinations of both operands
+    for (unsigned hl = 0; hl < 65536; hl += 257) {
+        for (unsigned de = 0; de < 65536; de += 251) {
+            uint8_t f = static_cast<uint8_t>((hl ^ de) & 0xf0);
+            uint8_t pgm[] = {
+                LD_SP_imm16(0xfffe),
+                LD_BC_imm16(f),
+                PUSH_BC,
+                POP_AF,
+                LD_HL_imm16(hl),
+                LD_DE_imm16(de),
+                ADD_HL_DE,
+                STOP(0),
+            };
+            runInRom(gbc, pgm, sizeof(pgm));
+            unsigned r = hl + de;
+            uint8_t expected = (f & Z) | flag((hl & 0xfff) + (de & 0xfff) > 0xfff, H) | flag(r > 0xffff, C);
+            if (gbc.state().hl() != (r & 0xffff) || gbc.state().f() != expected)
+                ++errors;
+        }
+    }
+    EXPECT(errors, 0u);
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include <platform/tests.h>
 
 #include "../lib/assembler.h"
@@ -12,3 +14,11 @@
 
 #define RUN(...) do { uint8_t pgm[] = { __VA_ARGS__ STOP(0) }; gbc.runTest(pgm, sizeof(pgm)); } while (false)
 #define EXPECT_FLAGS(...) EXPECT((int)gbc.state().f(), (static_cast<int>(__VA_ARGS__)))
+
+/** Runs the program from the start of a 32kb ROM image, i.e. the two ROM banks mapped by default, so that the memory map does not point past the end of a short program's array.
+ */
+inline void runInRom(GBC & gbc, uint8_t const * pgm, size_t numBytes) {
+    static uint8_t rom[32 * 1024];
+    memcpy(rom, pgm, numBytes);
+    gbc.runTest(rom, numBytes);
+}
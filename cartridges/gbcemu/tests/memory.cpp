@@ -1,7 +1,8 @@
 #include "gbctests.h"
 
 TEST(gbcemu, memory_initial_memmap) {
-    uint8_t const pgm[] = { STOP(0) };
+    // full 32kb ROM so that the expected pointers stay within the array
+    static uint8_t const pgm[32 * 1024] = { STOP(0) };
     GBC gbc{};
     gbc.runTest(pgm, sizeof(pgm));
     uint8_t const * const * mmap = gbc.state().memMap();
@@ -0,0 +1,254 @@
+#include "gbctests.h"
+
+using namespace rckid;
+
+// writes the given background palette bytes starting at index 0
+#define BG_PALETTE(...) LD_A_imm8(0x80), LDH_ptr8_A(0x68), __VA_ARGS__
+#define OBJ_PALETTE(...) LD_A_imm8(0x80), LDH_ptr8_A(0x6a), __VA_ARGS__
+#define PAL(LO, HI, REG) LD_A_imm8(LO), LDH_ptr8_A(REG), LD_A_imm8(HI), LDH_ptr8_A(REG)
+// white, red, green, blue
+#define BG_COLORS PAL(0xff, 0x7f, 0x69), PAL(0x1f, 0x00, 0x69), PAL(0xe0, 0x03, 0x69), PAL(0x00, 0x7c, 0x69)
+// (transparent), yellow, cyan, black
+#define OBJ_COLORS PAL(0x00, 0x00, 0x6b), PAL(0xff, 0x03, 0x6b), PAL(0xe0, 0x7f, 0x6b), PAL(0x00, 0x00, 0x6b)
+
+namespace {
+
+    constexpr ColorRGB White{255, 255, 255};
+    constexpr ColorRGB Red{255, 0, 0};
+    constexpr ColorRGB Green{0, 255, 0};
+    constexpr ColorRGB Blue{0, 0, 255};
+    constexpr ColorRGB Yellow{255, 255, 0};
+    constexpr ColorRGB Cyan{0, 255, 255};
+
+    /** Sets up the palettes and stops, after which it loops forever (JR to itself) so that frames can be run.
+     */
+    uint8_t const setupPgm[] = {
+        BG_PALETTE(BG_COLORS),
+        OBJ_PALETTE(OBJ_COLORS),
+        STOP(0),
+        JR(-2),
+    };
+
+    ColorRGB pixel(ColorRGB const * fb, int x, int y) {
+        return fb[(GBC::SCREEN_WIDTH - 1 - x) * GBC::SCREEN_HEIGHT + y];
+    }
+
+    /** Clears both VRAM banks and creates the test tiles. Tile 1 has color 1 in its left half and color 2 in its right half, tile 2 is all color 3.
+     */
+    void setupTiles(GBC & gbc) {
+        uint8_t * vram = gbc.state().vram();
+        for (size_t i = 0; i < 2 * 8192; ++i)
+            vram[i] = 0;
+        for (int row = 0; row < 8; ++row) {
+            vram[16 + row * 2] = 0xf0;
+            vram[16 + row * 2 + 1] = 0x0f;
+            vram[32 + row * 2] = 0xff;
+            vram[32 + row * 2 + 1] = 0xff;
+        }
+        gbc.invalidateTiles();
+    }
+
+}
+
+TEST(gbcemu, ppu_frameTiming) {
+    GBC gbc{};
+    gbc.runTest(setupPgm, sizeof(setupPgm));
+    uint8_t * io = gbc.state().ioRegs();
+    io[0x0f] = 0;
+    gbc.runFrame();
+    EXPECT(io[0x44], 144);
+    EXPECT(io[0x41] & 3, 1);
+    EXPECT(io[0x0f] & 1, 1);
+    // the frame took 144 lines, part of which was spent in the setup program
+    size_t frameDots = 144 * 456;
+    EXPECT(gbc.cyclesElapsed() + 400 >= frameDots && gbc.cyclesElapsed() <= frameDots);
+    // the next frame starts at line 0 after the 10 vblank lines
+    gbc.runFrame();
+    EXPECT(io[0x44], 144);
+    EXPECT(gbc.cyclesElapsed() + 12 >= 154 * 456 && gbc.cyclesElapsed() <= 154 * 456 + 12);
+}
+
+TEST(gbcemu, ppu_background) {
+    GBC gbc{};
+    gbc.runTest(setupPgm, sizeof(setupPgm));
+    // the setup ran past the first line, start in vblank so that the next frame is complete
+    gbc.runFrame();
+    setupTiles(gbc);
+    uint8_t * vram = gbc.state().vram();
+    // tile 1 at map (1, 0), flipped at (2, 0) and at (3, 1) with palette 1 (all white)
+    vram[0x1800 + 1] = 1;
+    vram[0x1800 + 2] = 1;
+    vram[0x2000 + 0x1800 + 2] = 0x20;
+    vram[0x1800 + 32 + 3] = 1;
+    vram[0x2000 + 0x1800 + 32 + 3] = 1;
+    ColorRGB fb[160 * 144];
+    gbc.setFramebuffer(fb);
+    gbc.runFrame();
+    EXPECT(pixel(fb, 0, 0) == White);
+    EXPECT(pixel(fb, 8, 0) == Red);
+    EXPECT(pixel(fb, 11, 7) == Red);
+    EXPECT(pixel(fb, 12, 3) == Green);
+    EXPECT(pixel(fb, 15, 0) == Green);
+    EXPECT(pixel(fb, 16, 0) == Green);
+    EXPECT(pixel(fb, 20, 0) == Red);
+    EXPECT(pixel(fb, 8, 8) == White);
+    EXPECT(pixel(fb, 24, 8) == White);
+    EXPECT(pixel(fb, 159, 143) == White);
+}
+
+TEST(gbcemu, ppu_scrollAndWindow) {
+    GBC gbc{};
+    gbc.runTest(setupPgm, sizeof(setupPgm));
+    // the setup ran past the first line, start in vblank so that the next frame is complete
+    gbc.runFrame();
+    setupTiles(gbc);
+    uint8_t * vram = gbc.state().vram();
+    uint8_t * io = gbc.state().ioRegs();
+    // background has tile 1 at (1, 1), window map tile 2 at (0, 0)
+    vram[0x1800 + 32 + 1] = 1;
+    vram[0x1c00] = 2;
+    io[0x42] = 2; // SCY
+    io[0x43] = 4; // SCX
+    io[0x4a] = 100; // WY
+    io[0x4b] = 80 + 7; // WX
+    io[0x40] |= 0x60; // window on, using the second map
+    ColorRGB fb[160 * 144];
+    gbc.setFramebuffer(fb);
+    gbc.runFrame();
+    EXPECT(pixel(fb, 4, 6) == Red);
+    EXPECT(pixel(fb, 4, 5) == White);
+    EXPECT(pixel(fb, 8, 6) == Green);
+    EXPECT(pixel(fb, 12, 6) == White);
+    EXPECT(pixel(fb, 79, 100) == White);
+    EXPECT(pixel(fb, 80, 99) == White);
+    EXPECT(pixel(fb, 80, 100) == Blue);
+    EXPECT(pixel(fb, 87, 107) == Blue);
+    EXPECT(pixel(fb, 88, 100) == White);
+    EXPECT(pixel(fb, 80, 108) == White);
+}
+
+TEST(gbcemu, ppu_sprites) {
+    GBC gbc{};
+    gbc.runTest(setupPgm, sizeof(setupPgm));
+    // the setup ran past the first line, start in vblank so that the next frame is complete
+    gbc.runFrame();
+    setupTiles(gbc);
+    uint8_t * vram = gbc.state().vram();
+    uint8_t * oam = gbc.state().oam();
+    for (size_t i = 0; i < 160; ++i)
+        oam[i] = 0;
+    // background tile 2 (blue) at (5, 1)
+    vram[0x1800 + 32 + 5] = 2;
+    // sprite 0 with tile 1 at (40, 10), sprite 1 flipped and overlapping it, sprite 2 behind the background at (40, 8)
+    uint8_t sprites[] = {
+        10 + 16, 40 + 8, 1, 0,
+        10 + 16, 42 + 8, 1, 0x20,
+        8 + 16, 36 + 8, 2, 0x80,
+    };
+    for (size_t i = 0; i < sizeof(sprites); ++i)
+        oam[i] = sprites[i];
+    gbc.state().ioRegs()[0x40] |= 0x02;
+    ColorRGB fb[160 * 144];
+    gbc.setFramebuffer(fb);
+    gbc.runFrame();
+    EXPECT(pixel(fb, 35, 10) == White);
+    EXPECT(pixel(fb, 40, 10) == Yellow);
+    EXPECT(pixel(fb, 44, 17) == Cyan);
+    // sprite 1 only shows past sprite 0
+    EXPECT(pixel(fb, 43, 10) == Yellow);
+    EXPECT(pixel(fb, 46, 10) == Cyan);
+    EXPECT(pixel(fb, 48, 10) == Yellow);
+    EXPECT(pixel(fb, 49, 10) == Yellow);
+    EXPECT(pixel(fb, 50, 10) == White);
+    EXPECT(pixel(fb, 40, 18) == White);
+    // sprite 2 is hidden by the blue background, but not by the white (color 0) one
+    EXPECT(pixel(fb, 36, 8) == ColorRGB{});
+    EXPECT(pixel(fb, 40, 8) == Blue);
+    EXPECT(pixel(fb, 43, 9) == Blue);
+    // all of which disappear when the sprites are disabled
+    gbc.state().ioRegs()[0x40] &= ~0x02;
+    gbc.runFrame();
+    EXPECT(pixel(fb, 40, 10) == Blue);
+    EXPECT(pixel(fb, 36, 8) == White);
+}
+
+TEST(gbcemu, ppu_lcdReenable) {
+    // turns the LCD off, waits for a while and turns it back on, reading STAT right after
+    uint8_t const pgm[] = {
+        // 0
+        LD_A_imm8(0x11),
+        LDH_ptr8_A(0x40),
+        // 4
+        LD_B_imm8(10),
+        // 6
+        DEC_B,
+        // 7
+        JR_NZ(6 - 9),
+        // 9
+        LD_A_imm8(0x91),
+        LDH_ptr8_A(0x40),
+        LDH_A_ptr8(0x41),
+        STOP(0),
+    };
+    for (GBC::Dispatch dispatch : { GBC::Dispatch::Switch, GBC::Dispatch::Default, GBC::Dispatch::BlockCache }) {
+        GBC gbc{};
+        gbc.setDispatch(dispatch);
+        gbc.runTest(pgm, sizeof(pgm));
+        // the time the LCD was off does not count towards the new first line, which is therefore still in the OAM scan
+        EXPECT(gbc.state().a() & 3, 2);
+        EXPECT(gbc.state().ioRegs()[0x44], 0);
+    }
+}
+
+TEST(gbcemu, ppu_statInterrupts) {
+    GBC gbc{};
+    gbc.runTest(setupPgm, sizeof(setupPgm));
+    uint8_t * io = gbc.state().ioRegs();
+    io[0x45] = 150; // LYC
+    io[0x41] |= 0x40; // LYC interrupt
+    gbc.runFrame();
+    io[0x0f] = 0;
+    gbc.runFrame();
+    // LY went through 150
+    EXPECT(io[0x0f] & 2, 2);
+    EXPECT(io[0x41] & 4, 0);
+    io[0x0f] = 0;
+    io[0x41] = (io[0x41] & ~0x40) | 0x08; // hblank interrupt
+    gbc.runFrame();
+    EXPECT(io[0x0f] & 2, 2);
+}
+
+TEST(gbcemu, ppu_tileCacheInvalidation) {
+    GBC gbc{};
+    // at line 10 change the first row of tile 1 to color 3
+    uint8_t pgm[] = {
+        BG_PALETTE(BG_COLORS),
+        STOP(0),
+        LDH_A_ptr8(0x44),
+        CP_A_imm8(10),
+        JR_NZ(-6),
+        LD_HL_imm16(0x8010),
+        LD_ptrHL_imm8(0xff),
+        INC_HL,
+        LD_ptrHL_imm8(0xff),
+        JR(-2),
+    };
+    gbc.runTest(pgm, sizeof(pgm));
+    setupTiles(gbc);
+    // tile 1 at map (1, 0), which is drawn before the change, and at (1, 2), drawn after
+    uint8_t * vram = gbc.state().vram();
+    vram[0x1800 + 1] = 1;
+    vram[0x1800 + 64 + 1] = 1;
+    ColorRGB fb[160 * 144];
+    gbc.setFramebuffer(fb);
+    gbc.runFrame();
+    EXPECT(pixel(fb, 8, 1) == Red);
+    EXPECT(pixel(fb, 8, 16) == Blue);
+    EXPECT(pixel(fb, 12, 16) == Blue);
+    EXPECT(pixel(fb, 8, 17) == Red);
+    EXPECT(pixel(fb, 12, 17) == Green);
+    // the next frame uses the new row for both
+    gbc.runFrame();
+    EXPECT(pixel(fb, 8, 0) == Blue);
+    EXPECT(pixel(fb, 12, 0) == Blue);
+}
@@ -29,6 +29,7 @@
 //#include <rckid/comms/connection.h>
 
 #include <rckid/assets/icons.h>
+#include <rckid/assets/icons_native.h>
 
 
 using namespace rckid;
@@ -60,10 +61,10 @@ Menu * menuBenchmarks() {
 
 Menu * mainMenu() {
     return new Menu{
-        MenuApp::Submenu("Games", assets::icons::game_controller, menuGames),
-        MenuApp::Submenu("Utils", assets::icons::applications, menuUtils),
-        MenuApp::Submenu("Settings", assets::icons::settings, menuGames),
-        MenuApp::Submenu("Benchmarks", assets::icons::spider, menuBenchmarks),
+        MenuApp::Submenu("Games", ImageAsset{assets::icons_native::game_controller}, menuGames),
+        MenuApp::Submenu("Utils", ImageAsset{assets::icons_native::applications}, menuUtils),
+        MenuApp::Submenu("Settings", ImageAsset{assets::icons_native::settings}, menuGames),
+        MenuApp::Submenu("Benchmarks", ImageAsset{assets::icons_native::spider}, menuBenchmarks),
     };
 }
 
@@ -44,6 +44,8 @@ extern "C" {
     /// TODO: only works on linux for now
 #if (defined __linux__)
     extern void *__libc_malloc(size_t);
+    extern void *__libc_calloc(size_t, size_t);
+    extern void *__libc_realloc(void *, size_t);
     extern void __libc_free(void *);
 
     void * malloc(size_t numBytes) {
@@ -53,6 +55,22 @@ extern "C" {
             return rckid::malloc(numBytes);
     }
 
+    void * calloc(size_t numItems, size_t itemSize) {
+        if (systemMalloc_)
+            return __libc_calloc(numItems, itemSize);
+        else 
+            return rckid::calloc(numItems, itemSize);
+    }
+
+    void * realloc(void * ptr, size_t numBytes) {
+        if (ptr == nullptr)
+            return malloc(numBytes);
+        if (rckid::memoryIsOnHeap(ptr))
+            return rckid::realloc(ptr, numBytes);
+        else
+            return __libc_realloc(ptr, numBytes);
+    }
+
     void free(void * ptr) {
         if (rckid::memoryIsOnHeap(ptr)) {
             // if we are in system malloc phase, we should not be deallocating rckid memory, as this only happens during shutdown
@@ -115,9 +133,18 @@ namespace rckid {
         uint8_t displayBrightness_ = 255;
         size_t displayUpdating_ = 0; 
         Rect displayRect_ = Rect::WH(320, 240);
+        /** The update region in physical display pixels, which in the double modes is twice the size of the update region.
+         */
+        Rect displayPhysicalRect_ = Rect::WH(320, 240);
         size_t displayMax_ = 320 * 240;
         int displayUpdateX_ = 319;
         int displayUpdateY_ = 0;
+        /** Set when the last pixel of the update region has been written, at which point the display image is redrawn. 
+         */
+        bool displayFrameDone_ = false;
+        /** When set, the pixels are passed to the capture callback instead of the display image (see displayCapture()).
+         */
+        DisplayCaptureCallback displayCapture_;
         Image displayImg_;
         Texture displayTexture_;
         std::chrono::steady_clock::time_point displayLastVSyncTime_;
@@ -307,13 +334,54 @@ namespace rckid {
 
     Rect displayUpdateRegion() { return displayRect_; }
 
+    /** Returns true if the display is in one of the double modes, where the update region is in 160x120 coordinates and each pixel is shown as 2x2 block.
+     */
+    bool displayDouble() {
+        return displayMode_ == DisplayMode::NativeDouble || displayMode_ == DisplayMode::NaturalDouble;
+    }
+
+    /** Returns true if the display expects the pixels in the natural, i.e. row first, top to bottom left to right order.
+     */
+    bool displayNatural() {
+        return displayMode_ == DisplayMode::Natural || displayMode_ == DisplayMode::NaturalDouble;
+    }
+
     void displaySetUpdateRegion(Rect region) { 
         displayRect_ = region; 
         displayMax_ = region.w * region.h;
         ASSERT(region.w > 0 && region.h > 0 && region.x >= 0 && region.y >= 0);
-        ASSERT(region.bottom() <= 240 && region.right() <= 320);
-        displayUpdateX_ = displayRect_.right() - 1;
-        displayUpdateY_ = displayRect_.top();
+        if (displayDouble()) {
+            ASSERT(region.bottom() <= 120 && region.right() <= 160);
+            displayPhysicalRect_ = Rect::XYWH(region.x * 2, region.y * 2, region.w * 2, region.h * 2);
+        } else {
+            ASSERT(region.bottom() <= 240 && region.right() <= 320);
+            displayPhysicalRect_ = region;
+        }
+        displayUpdateX_ = displayNatural() ? displayPhysicalRect_.left() : displayPhysicalRect_.right() - 1;
+        displayUpdateY_ = displayPhysicalRect_.top();
+    }
+
+    /** Moves the update position to the next physical pixel in the order expected by the current display mode, wrapping around the update region.
+     */
+    void displayAdvance() {
+        Rect const & r = displayPhysicalRect_;
+        if (displayNatural()) {
+            if (++displayUpdateX_ == r.right()) {
+                displayUpdateX_ = r.left();
+                if (++displayUpdateY_ == r.bottom()) {
+                    displayUpdateY_ = r.top();
+                    displayFrameDone_ = true;
+                }
+            }
+        } else {
+            if (++displayUpdateY_ == r.bottom()) {
+                displayUpdateY_ = r.top();
+                if (--displayUpdateX_ < r.left()) {
+                    displayUpdateX_ = r.right() - 1; 
+                    displayFrameDone_ = true;
+                }
+            }
+        }
     }
 
     bool displayUpdateActive() { return displayUpdating_ > 0; }
@@ -331,18 +399,20 @@ namespace rckid {
 
     void displayUpdate(ColorRGB const * pixels, uint32_t numPixels) {
         ++displayUpdating_;
-        // update the pixels
+        // update the pixels, in the double modes each pixel is sent twice like the device's PIO program does, while doubling in the other direction is up to the renderer
+        int repeat = displayDouble() ? 2 : 1;
         while (numPixels != 0) {
-            ImageDrawPixel(&displayImg_, displayUpdateX_, displayUpdateY_, { pixels->r(), pixels->g(), pixels->b(), 255});
+            for (int i = 0; i < repeat; ++i) {
+                if (displayCapture_)
+                    displayCapture_(displayUpdateX_, displayUpdateY_, *pixels);
+                else
+                    ImageDrawPixel(&displayImg_, displayUpdateX_, displayUpdateY_, { pixels->r(), pixels->g(), pixels->b(), 255});
+                displayAdvance();
+            }
             ++pixels;
             --numPixels;
-            if (++displayUpdateY_ == displayRect_.bottom()) {
-                displayUpdateY_ = displayRect_.top();
-                if (--displayUpdateX_ < displayRect_.left())
-                    displayUpdateX_ = displayRect_.right() - 1; 
-            }
         }
-        // check if this is the first update call, in which case call all the other updates (as long as the callback generates a new update) and when no more updates are scheduled, actually redraw the display. Note that if the update is not the first, no callbacks are called
+        // check if this is the first update call, in which case call all the other updates (as long as the callback generates a new update) and when no more updates are scheduled, redraw the display if the whole update region has been written. The frame can be sent in multiple update chains (see RenderPipeline), which must not redraw the window each. Note that if the update is not the first, no callbacks are called
         if (displayUpdating_ == 1) {
             while (true) {
                 size_t updatingOld = displayUpdating_;
@@ -353,7 +423,11 @@ namespace rckid {
             }
             displayUpdating_ = 0;
             displayCallback_ = nullptr;
-            displayDraw();
+            if (displayFrameDone_) {
+                displayFrameDone_ = false;
+                if (!displayCapture_)
+                    displayDraw();
+            }
         }
     }
 
@@ -362,6 +436,10 @@ namespace rckid {
         displayUpdate(pixels, numPixels);
     }
 
+    void displayCapture(DisplayCaptureCallback callback) {
+        displayCapture_ = callback;
+    }
+
     // audio
 
     void audioStreamRefill(void * buffer, unsigned int frames) {
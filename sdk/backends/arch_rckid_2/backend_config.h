@@ -194,6 +194,10 @@
  */
 #define RP_ST7789_BAUDRATE 15000000
 
+/** Number of 32bit words from which memFill uses DMA instead of the CPU. Below this, the time needed to configure the DMA channel is larger than what it saves.
+ */
+#define RP_MEMFILL_DMA_THRESHOLD 128
+
 
 
 
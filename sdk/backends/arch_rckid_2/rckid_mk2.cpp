@@ -64,6 +64,13 @@ namespace rckid {
             uint32_t sampleRate_ = 44100;
         }
 
+        namespace fill {
+            uint dma_ = 0;
+            /** The DMA reads the fill value from memory, without incrementing the read address.
+             */
+            volatile uint32_t value_;
+        }
+
     }
 
     /** Waits for the end of tick's async operations. 
@@ -293,6 +300,9 @@ namespace rckid {
         audio::dma0_ = dma_claim_unused_channel(true);
         audio::dma1_ = dma_claim_unused_channel(true);
 
+        // DMA channel for large memory fills
+        fill::dma_ = dma_claim_unused_channel(true);
+
         // initialize the SD card
         sdInitialize();
 
@@ -637,6 +647,19 @@ namespace rckid {
     #include "rckid/accelerated.inc.h"
     MEM_FILL_8
     MEM_FILL_16
-    MEM_FILL_32
+
+    /** Large fills are done by DMA, which writes a word every cycle. The fill is still blocking as memFill's callers expect the memory to be filled on return, but the DMA is faster than the CPU and does not need the cycles spent on the loop.
+     */
+    void memFill(uint32_t * buffer, uint32_t size, uint32_t value) {
+        if (size < RP_MEMFILL_DMA_THRESHOLD)
+            return memFillWords(buffer, size, value);
+        fill::value_ = value;
+        dma_channel_config c = dma_channel_get_default_config(fill::dma_);
+        channel_config_set_transfer_data_size(& c, DMA_SIZE_32);
+        channel_config_set_read_increment(& c, false);
+        channel_config_set_write_increment(& c, true);
+        dma_channel_configure(fill::dma_, & c, buffer, & fill::value_, size, true);
+        dma_channel_wait_for_finish_blocking(fill::dma_);
+    }
 
 }
\ No newline at end of file
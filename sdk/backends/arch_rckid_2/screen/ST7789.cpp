@@ -99,19 +99,23 @@ namespace rckid {
                 setColumnRange(rect.top(), rect.bottom() - 1);
                 setRowRange(rect.left(), rect.right() - 1);
                 break;
+            // in the double modes the region is in 160x120 coordinates, the PIO program sends every pixel twice, doubling the pixels along the data stream, and the renderer is expected to send every column (native) or row (natural) twice
             case DisplayMode::NativeDouble:
-                UNIMPLEMENTED;
+                setColumnRange(rect.top() * 2, rect.bottom() * 2 - 1);
+                setRowRange(rect.left() * 2, rect.right() * 2 - 1);
                 break;
             case DisplayMode::Natural:
                 setRowRange(rect.top(), rect.bottom() - 1);
                 setColumnRange(rect.left(), rect.right() - 1);
                 break;
             case DisplayMode::NaturalDouble:
-                UNIMPLEMENTED;
+                setRowRange(rect.top() * 2, rect.bottom() * 2 - 1);
+                setColumnRange(rect.left() * 2, rect.right() * 2 - 1);
                 break;
             default:
                 UNREACHABLE;
         }
+        updateRegion_ = rect;
     }
 
     void ST7789::enterCommandMode() {
@@ -81,6 +81,8 @@ namespace rckid {
 
         static Rect updateRegion() { return updateRegion_; }
 
+        /** Sets the update region. In the double modes the region is in the 160x120 coordinates of the doubled display.
+         */
         static void setUpdateRegion(Rect rect); 
 
         /** Sets the framerate of the display.
@@ -1,14 +1,50 @@
+/** Portable implementations of the accelerated functions.
+
+    The file is included inside the rckid namespace by the backends, which then expand the macros for the functions they do not provide a hardware specific version of.
+
+    All memFill variants align the buffer first and then fill it with 32bit stores via memFill(uint32_t *), so a backend that overrides only that (e.g. with a DMA fill for large buffers) speeds up all the others as well. The word fill itself is unrolled 8 times.
+ */
+
+/** Fills the words with an unrolled loop, to be used by the backends' memFill(uint32_t*) either directly, or for fills too small for DMA.
+ */
+inline void memFillWords(uint32_t * buffer, uint32_t size, uint32_t value) {
+    while (size >= 8) {
+        buffer[0] = value;
+        buffer[1] = value;
+        buffer[2] = value;
+        buffer[3] = value;
+        buffer[4] = value;
+        buffer[5] = value;
+        buffer[6] = value;
+        buffer[7] = value;
+        buffer += 8;
+        size -= 8;
+    }
+    while (size-- != 0)
+        *(buffer++) = value;
+}
+
 #define MEM_FILL_8 void memFill(uint8_t * buffer, uint32_t size, uint8_t value) { \
-    while (size-- != 0) \
+    while ((reinterpret_cast<uintptr_t>(buffer) & 3) && size != 0) { \
+        *(buffer++) = value; \
+        --size; \
+    } \
+    memFill(reinterpret_cast<uint32_t*>(buffer), size >> 2, value * 0x01010101u); \
+    buffer += size & ~3u; \
+    for (size &= 3; size != 0; --size) \
         *(buffer++) = value; \
 }
 
 #define MEM_FILL_16 void memFill(uint16_t * buffer, uint32_t size, uint16_t value) { \
-    while (size-- != 0) \
+    if ((reinterpret_cast<uintptr_t>(buffer) & 2) && size != 0) { \
         *(buffer++) = value; \
+        --size; \
+    } \
+    memFill(reinterpret_cast<uint32_t*>(buffer), size >> 1, value * 0x00010001u); \
+    if (size & 1) \
+        buffer[size - 1] = value; \
 }
 
 #define MEM_FILL_32 void memFill(uint32_t * buffer, uint32_t size, uint32_t value) { \
-    while (size-- != 0) \
-        *(buffer++) = value; \
+    memFillWords(buffer, size, value); \
 }
@@ -1,4 +1,5 @@
 #include "app.h"
+#include "graphics/render_pipeline.h"
 
 namespace rckid {
 
@@ -11,6 +12,8 @@ namespace rckid {
         //    current_->onBlur();
         App * lastApp = current_;
         current_ = this;
+        ScratchArena scratch{RCKID_FRAME_SCRATCH_SIZE};
+        FrameScratch frameScratch{scratch};
         onFocus();
         // add extra tick to ensure that button presses are cleared. We really need only the first tick, the second tick is there to ensure that any async processes of the first tick will actually finish before the update method call in the loop (tick waits for completion of previous one)
         tick();
@@ -23,9 +26,12 @@ namespace rckid {
             MEASURE_TIME(updateUs_,     update());
             MEASURE_TIME(tickUs_,       tick());
             MEASURE_TIME(waitRenderUs_, displayWaitUpdateDone());
+            scratch.reset();
             MEASURE_TIME(drawUs_,       draw());
             // don't wait for Vsync here as the rendering might want to preprocess the graphic data first
             MEASURE_TIME(renderUs_,     render());
+            // add the time the renderer had to wait for the display to free its buffers
+            waitRenderUs_ += RenderPipeline::takeStallUs();
             ++currentFps;
             uint32_t uus = uptimeUs();
             currentFrame += uus - lastFrame;
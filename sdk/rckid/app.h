@@ -4,6 +4,7 @@
 
 #include "rckid.h"
 #include "graphics/drawing.h"
+#include "utils/scratch_arena.h"
 
 namespace rckid {
 
@@ -27,9 +28,35 @@ namespace rckid {
         static uint32_t drawUs() { return drawUs_; }
         static uint32_t renderUs() { return renderUs_; }
         static uint32_t waitVSyncUs() { return waitVSyncUs_; }
+        /** Time spent waiting for the display, i.e. for the previous frame to be sent before drawing and for the display to free the render buffers while rendering (see RenderPipeline).
+         */
         static uint32_t waitRenderUs() { return waitRenderUs_; }
         static uint32_t fps() { return fps_; }
 
+        /** Returns the scratch arena of the currently running app. 
+         
+            The arena is reset every frame once the rendering of the previous frame is done, i.e. right before draw(), so that draw() and render() can use it for temporaries of the frame without going through the heap. Anything allocated in update() is released before draw(). 
+         */
+        static ScratchArena & frameScratch() {
+            ASSERT(frameScratch_ != nullptr);
+            return *frameScratch_;
+        }
+
+        /** Returns true if there is a frame scratch arena, i.e. if called from within a running app, or when one has been provided by FrameScratch. 
+         */
+        static bool hasFrameScratch() { return frameScratch_ != nullptr; }
+
+        /** Makes the given arena the frame scratch for the lifetime of the object, restoring the previous one when destroyed. App::loop() uses it for the app's arena, code that runs outside of an app, such as tests, can provide its own.
+         */
+        class FrameScratch {
+        public:
+            explicit FrameScratch(ScratchArena & arena): last_{frameScratch_} { frameScratch_ = & arena; }
+            FrameScratch(FrameScratch const &) = delete;
+            ~FrameScratch() { frameScratch_ = last_; }
+        private:
+            ScratchArena * last_;
+        }; // App::FrameScratch
+
     protected:
 
         /** Runs the app's main loop until exit() is called.
@@ -86,6 +113,7 @@ namespace rckid {
     private:
 
         static inline App * current_ = nullptr;
+        static inline ScratchArena * frameScratch_ = nullptr;
 
         static inline uint32_t tickUs_ = 0;
         static inline uint32_t updateUs_ = 0;
@@ -0,0 +1,33 @@
+#pragma once
+
+// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets
+
+#include "../rckid.h"
+
+// Folder: icons-native, 16 bpp
+namespace rckid::assets::icons_native{
+
+    // File: 113-spider.png
+    // Size: 8200
+    alignas(4) static constexpr uint8_t spider[] = {
+        #include "raw/icons_native/113-spider.h"
+    };
+
+    // File: 118-applications.png
+    // Size: 8200
+    alignas(4) static constexpr uint8_t applications[] = {
+        #include "raw/icons_native/118-applications.h"
+    };
+
+    // File: 013-settings.png
+    // Size: 8200
+    alignas(4) static constexpr uint8_t settings[] = {
+        #include "raw/icons_native/013-settings.h"
+    };
+
+    // File: 001-game-controller.png
+    // Size: 8200
+    alignas(4) static constexpr uint8_t game_controller[] = {
+        #include "raw/icons_native/001-game-controller.h"
+    };
+} // namespace rckid::assets::icons_native
@@ -0,0 +1,517 @@
+// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets
+// Input file: "icons-native/001-game-controller.png"
+// Image:      64x64, 16 bpp, 0 palette colors
+// Size:       8200 bytes
+64,0,64,0,16,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+132,8,48,58,23,75,57,83,89,83,58,83,58,83,57,91,
+246,98,48,74,99,16,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,231,24,23,75,
+58,75,58,75,58,75,58,75,58,75,58,75,58,75,58,75,
+58,75,58,75,90,83,154,131,184,163,20,139,45,90,197,32,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,180,66,58,75,58,75,
+58,75,58,75,58,75,58,75,58,75,58,75,58,75,58,75,
+58,75,58,75,58,75,58,75,90,91,219,155,28,188,28,188,
+251,187,218,179,86,155,144,114,72,57,33,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,98,8,56,75,58,75,58,75,58,75,
+58,75,58,75,58,75,58,75,58,83,90,83,58,83,58,75,
+58,75,58,75,58,75,58,75,58,75,58,83,155,131,252,187,
+28,188,28,188,28,188,28,188,28,188,28,188,251,179,152,163,
+210,130,204,81,131,16,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,66,8,57,83,58,75,58,75,58,75,58,75,
+90,83,154,91,218,99,251,107,251,107,251,107,251,107,27,108,
+219,99,154,91,90,83,58,75,58,75,58,75,58,75,155,131,
+28,188,28,188,28,188,28,188,28,188,28,188,28,188,28,188,
+28,188,28,188,28,188,27,188,217,171,20,139,73,57,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,23,75,58,75,58,75,58,75,122,83,218,99,
+251,107,251,107,251,107,251,107,251,107,251,107,253,100,191,101,
+191,101,189,100,251,107,186,99,90,83,58,75,58,75,58,75,
+187,147,28,188,28,188,28,188,28,188,28,188,28,188,28,188,
+28,188,28,188,28,188,28,188,28,188,28,188,28,188,218,179,
+7,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,81,58,58,75,58,75,58,83,186,99,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,91,108,191,101,191,101,
+191,101,191,101,27,108,251,107,251,107,154,91,58,75,58,75,
+90,83,124,180,156,196,92,196,60,196,28,188,28,188,28,188,
+28,188,28,188,28,188,28,188,28,188,28,188,28,188,28,188,
+28,188,204,81,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+98,8,58,83,58,75,90,83,218,99,251,107,251,107,120,132,
+244,156,88,124,251,107,251,107,251,107,124,108,191,101,191,101,
+191,101,191,101,27,108,251,107,251,107,251,107,186,99,58,75,
+58,75,186,115,188,204,188,204,188,204,188,204,188,204,156,196,
+124,196,92,196,60,188,28,188,28,188,28,188,28,188,28,188,
+28,188,28,188,7,49,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+179,66,58,75,90,83,250,107,251,107,251,107,213,148,230,254,
+230,254,199,246,151,140,251,107,251,107,251,107,62,101,191,101,
+191,101,253,100,251,107,251,107,251,107,251,107,251,107,186,99,
+58,75,58,83,124,180,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,156,204,124,196,60,196,28,188,
+28,188,28,188,218,179,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+57,83,58,75,218,99,251,107,251,107,251,107,43,214,230,254,
+230,254,230,254,206,197,251,107,251,107,251,107,251,107,124,108,
+91,108,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+154,91,58,75,251,131,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+60,196,28,188,28,188,73,57,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,25,
+58,75,154,91,251,107,251,107,251,107,251,107,237,205,230,254,
+230,254,230,254,143,189,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,90,83,122,99,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,92,196,28,188,19,139,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,58,
+90,83,251,107,251,107,251,107,251,107,251,107,120,124,105,230,
+230,254,75,222,57,116,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,218,99,58,83,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,60,196,152,163,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,66,
+186,91,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+26,116,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,59,108,27,108,251,107,251,107,251,107,251,107,
+251,107,251,107,122,91,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,156,204,152,163,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,75,
+250,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,61,125,95,142,95,142,253,124,251,107,251,107,251,107,
+251,107,251,107,186,107,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,210,130,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,75,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+123,116,95,142,95,142,95,142,95,142,59,108,251,107,251,107,
+251,107,251,107,27,124,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,72,57,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,75,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,121,132,23,157,89,124,251,107,251,107,251,107,
+124,116,95,142,95,142,95,142,95,142,59,108,251,107,251,107,
+251,107,251,107,91,148,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,25,172,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,247,148,47,255,79,255,48,255,184,140,251,107,251,107,
+251,107,158,133,95,142,95,142,93,125,251,107,251,107,251,107,
+251,107,251,107,156,180,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,104,57,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,83,214,79,255,79,255,79,255,20,198,251,107,251,107,
+251,107,251,107,124,116,123,116,251,107,251,107,251,107,251,107,
+251,107,27,116,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,110,98,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,19,198,79,255,79,255,79,255,212,189,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,92,156,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,123,196,
+235,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,89,124,146,222,79,255,114,222,58,116,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+27,108,188,196,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,156,196,182,155,77,98,98,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,26,108,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+91,148,188,204,188,204,188,204,188,204,188,204,188,204,156,196,
+215,163,209,122,235,81,229,40,32,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+156,188,188,204,188,196,215,163,241,122,236,81,230,40,32,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,119,91,
+12,82,6,41,32,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,249,107,214,99,249,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,139,41,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,4,25,106,58,106,66,106,66,106,66,215,115,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,215,99,111,91,110,91,111,91,
+216,107,251,107,251,107,251,107,251,107,251,107,217,99,33,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,97,8,13,83,13,83,13,83,13,83,13,83,122,172,
+124,164,27,108,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,146,91,110,91,110,91,110,91,
+147,99,251,107,251,107,251,107,251,107,251,107,79,58,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,102,33,13,83,13,83,13,83,13,83,13,83,121,172,
+188,204,156,188,27,124,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,179,99,110,91,110,91,110,91,
+180,99,251,107,251,107,251,107,251,107,251,107,164,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,102,33,78,83,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,196,59,140,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,249,107,145,91,111,91,145,91,
+250,107,251,107,251,107,251,107,251,107,244,82,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,4,25,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,91,148,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,250,107,251,107,
+251,107,251,107,251,107,251,107,251,107,73,33,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,24,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,188,204,27,124,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,218,107,33,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,24,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,188,204,124,164,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,20,83,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,44,91,252,206,252,214,252,214,
+252,214,252,214,252,214,252,214,252,214,252,214,252,214,252,214,
+252,214,248,181,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,188,204,156,180,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,145,66,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,45,91,252,206,252,214,252,214,
+252,214,252,214,252,214,252,214,252,214,252,214,252,214,252,214,
+252,214,248,173,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,188,204,156,180,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,145,66,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,24,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,188,204,124,164,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,20,83,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,24,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,188,204,27,124,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,218,107,33,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,24,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,204,188,204,91,148,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,73,33,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,24,110,91,110,91,110,91,110,91,110,91,121,172,
+188,204,188,204,188,196,59,140,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,244,82,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,227,16,110,91,110,91,110,91,110,91,110,91,122,172,
+188,204,156,188,27,124,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,164,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,33,0,46,83,110,91,110,91,110,91,110,91,122,172,
+124,164,27,108,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,79,58,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,130,16,167,41,167,41,167,41,167,41,150,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,217,99,33,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,139,41,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,152,99,
+210,130,171,73,66,8,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+27,172,28,188,28,188,251,187,152,163,210,122,170,65,65,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,131,28,188,28,188,28,188,28,188,28,188,28,188,28,188,
+251,187,151,163,178,122,138,65,33,8,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,155,132,92,157,92,157,60,149,59,116,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+27,108,252,179,28,188,28,188,28,188,28,188,28,188,28,188,
+28,188,28,188,28,188,28,188,28,188,250,179,20,139,164,24,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,253,206,61,223,61,223,61,223,156,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,59,156,60,196,28,188,28,188,28,188,28,188,28,188,
+28,188,28,188,28,188,28,188,28,188,28,188,28,188,28,188,
+178,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,29,215,61,223,61,223,61,223,188,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,27,116,188,204,188,204,156,204,124,196,92,196,60,188,
+28,188,28,188,28,188,28,188,28,188,28,188,28,188,28,188,
+28,188,53,147,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,29,215,61,223,61,223,61,223,188,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,156,172,188,204,188,204,188,204,188,204,188,204,
+188,204,156,196,124,196,92,196,28,188,28,188,28,188,28,188,
+28,188,28,188,46,98,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,29,215,61,223,61,223,61,223,188,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,91,148,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,124,196,60,188,
+28,188,28,188,27,188,32,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,74,
+251,107,251,107,251,107,251,107,251,107,251,107,187,132,92,190,
+124,190,124,190,157,198,61,223,61,223,61,223,61,223,29,215,
+124,190,124,190,124,190,28,182,27,108,251,107,251,107,251,107,
+251,107,251,107,27,124,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+124,196,28,188,28,188,13,90,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,74,
+251,107,251,107,251,107,251,107,251,107,251,107,252,173,61,223,
+61,223,61,223,61,223,61,223,61,223,61,223,61,223,61,223,
+61,223,61,223,61,223,61,223,155,132,251,107,251,107,251,107,
+251,107,251,107,27,116,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,124,196,28,188,85,147,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,58,
+251,107,251,107,251,107,251,107,251,107,251,107,252,173,61,223,
+61,223,61,223,61,223,61,223,61,223,61,223,61,223,61,223,
+61,223,61,223,61,223,61,223,187,132,251,107,251,107,251,107,
+251,107,251,107,251,107,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,92,196,184,163,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,49,
+251,107,251,107,251,107,251,107,251,107,251,107,252,173,61,223,
+61,223,61,223,61,223,61,223,61,223,61,223,61,223,61,223,
+61,223,61,223,61,223,61,223,187,132,251,107,251,107,251,107,
+251,107,251,107,27,116,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,119,155,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,197,16,
+251,107,251,107,251,107,251,107,251,107,251,107,219,132,125,190,
+124,198,124,198,157,198,61,223,61,223,61,223,61,223,29,215,
+124,198,124,198,124,198,60,182,27,116,251,107,251,107,251,107,
+251,107,251,107,59,124,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,111,106,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+152,99,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,29,215,61,223,61,223,61,223,220,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,91,156,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,197,32,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+46,58,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,29,215,61,223,61,223,61,223,188,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,156,188,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,116,147,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+66,0,217,99,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,29,215,61,223,61,223,61,223,188,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,59,140,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,123,196,164,24,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,204,49,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,253,206,61,223,61,223,61,223,156,165,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+27,116,156,188,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+123,196,39,49,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,210,74,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,187,132,124,157,124,157,92,157,59,116,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+124,172,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,117,147,
+164,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,33,0,86,91,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,91,148,
+188,204,188,204,188,204,188,204,188,204,188,204,188,204,188,204,
+188,204,188,204,188,204,25,180,51,139,77,90,229,32,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,66,8,244,74,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,91,156,188,204,
+188,204,188,204,188,204,188,204,188,204,155,196,215,163,209,122,
+12,82,38,49,65,8,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,79,58,250,107,251,107,
+251,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,251,107,251,107,27,116,124,172,188,204,188,204,
+90,188,116,147,143,106,170,73,197,32,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,132,16,211,74,
+250,107,251,107,251,107,251,107,251,107,251,107,251,107,251,107,
+251,107,251,107,27,116,249,139,19,131,77,90,104,57,98,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+98,8,171,41,210,74,151,91,218,107,250,107,250,115,185,107,
+52,99,13,66,66,8,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
\ No newline at end of file
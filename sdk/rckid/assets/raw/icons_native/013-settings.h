@@ -0,0 +1,517 @@
+// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets
+// Input file: "icons-native/013-settings.png"
+// Image:      64x64, 16 bpp, 0 palette colors
+// Size:       8200 bytes
+64,0,64,0,16,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+153,92,95,109,95,109,95,109,95,109,95,109,95,109,153,92,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+61,101,95,109,95,109,95,109,95,109,95,109,95,109,61,101,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,228,16,163,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+163,8,228,16,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,33,0,245,75,95,109,61,101,
+33,0,0,0,0,0,0,0,0,0,0,0,0,0,98,8,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+98,8,0,0,0,0,0,0,0,0,0,0,0,0,33,0,
+61,101,95,109,245,75,33,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,207,50,94,109,95,109,95,109,95,109,
+185,92,0,0,0,0,0,0,0,0,0,0,0,0,49,59,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+48,59,0,0,0,0,0,0,0,0,0,0,0,0,185,92,
+95,109,95,109,95,109,94,109,207,50,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,136,33,28,101,95,109,95,109,95,109,95,109,95,109,
+95,109,245,75,0,0,0,0,0,0,0,0,5,17,127,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,5,17,0,0,0,0,0,0,0,0,245,75,95,109,
+95,109,95,109,95,109,95,109,95,109,28,101,136,33,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,94,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,251,100,16,59,141,50,54,76,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,54,76,141,50,16,59,251,100,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,94,109,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,245,75,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,245,75,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,196,8,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,196,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,28,101,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,28,101,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,54,84,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,54,76,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,120,84,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,87,84,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,33,0,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,94,109,33,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,136,33,94,109,245,75,228,16,0,0,0,0,0,0,
+33,0,218,92,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,218,92,33,0,
+0,0,0,0,0,0,228,16,245,75,94,109,136,33,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,28,101,95,109,95,109,95,109,28,101,54,76,87,84,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,94,109,
+119,84,54,76,28,101,95,109,95,109,95,109,28,101,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+207,50,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,63,101,
+255,92,255,84,223,76,223,76,223,76,223,76,255,84,255,92,
+63,101,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,207,50,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,
+94,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,63,101,255,84,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,255,84,63,101,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,94,109,
+33,0,0,0,0,0,0,0,0,0,0,0,0,0,245,75,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,255,92,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,255,84,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+245,75,0,0,0,0,0,0,0,0,0,0,228,16,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,63,101,223,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,223,76,63,101,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,228,16,0,0,0,0,0,0,0,0,163,8,61,101,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+31,93,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,31,93,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+61,101,163,8,0,0,0,0,0,0,0,0,0,0,33,0,
+185,92,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,31,93,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+31,93,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,185,92,
+33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,245,75,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,63,101,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,63,101,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,245,75,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,28,101,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,158,76,92,76,92,68,158,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,251,100,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,48,59,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,255,84,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,191,76,158,76,
+209,50,98,0,0,0,0,0,0,0,0,0,98,8,209,50,
+158,76,191,76,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,255,84,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,16,59,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,174,50,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,63,101,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,191,76,118,59,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,118,59,191,76,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,63,101,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,141,50,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,54,84,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,255,84,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,191,76,144,42,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,144,42,191,76,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,255,84,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,54,76,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,5,17,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,118,59,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,118,59,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,5,17,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,8,
+49,59,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,63,101,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,158,76,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,32,0,158,76,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,63,101,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,48,59,
+98,8,0,0,0,0,0,0,153,92,61,101,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,255,92,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,177,42,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,209,50,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,255,92,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,61,101,153,92,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,255,84,191,76,191,76,191,76,191,76,
+191,76,191,76,191,76,98,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,98,8,191,76,191,76,191,76,
+191,76,191,76,191,76,191,76,223,84,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,223,76,191,76,191,76,191,76,191,76,
+191,76,191,76,158,76,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,158,76,191,76,191,76,
+191,76,191,76,191,76,191,76,223,76,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,223,76,191,76,191,76,191,76,191,76,
+191,76,191,76,92,68,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,92,68,191,76,191,76,
+191,76,191,76,191,76,191,76,223,76,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,127,109,95,109,95,109,95,109,95,109,
+95,109,95,109,149,67,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,149,67,95,109,95,109,
+95,109,95,109,95,109,95,109,127,109,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,159,109,95,109,95,109,95,109,95,109,
+95,109,95,109,24,84,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,24,84,95,109,95,109,
+95,109,95,109,95,109,95,109,159,109,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,223,117,95,109,95,109,95,109,95,109,
+95,109,95,109,30,101,33,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,33,0,30,101,95,109,95,109,
+95,109,95,109,95,109,95,109,223,117,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,177,67,214,92,250,109,190,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,31,118,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,202,33,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,202,33,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,31,118,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+190,126,250,109,214,92,177,67,0,0,0,0,0,0,65,0,
+74,42,251,109,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,127,126,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,89,84,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,90,84,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,127,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,250,109,42,42,
+65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,163,8,60,118,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,190,126,127,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,78,42,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,110,42,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,127,109,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,27,118,162,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,46,59,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,255,117,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,63,109,137,33,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,169,33,63,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,255,117,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,46,59,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,167,33,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,158,126,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,63,109,78,42,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,110,42,63,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,158,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,167,25,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9,34,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,255,117,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,90,84,
+170,33,33,0,0,0,0,0,0,0,0,0,33,0,202,33,
+90,84,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,255,117,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,9,34,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,116,84,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,190,126,127,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,30,101,24,84,149,67,149,67,24,84,30,101,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,159,109,190,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,116,84,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,237,50,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,127,126,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,127,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,237,50,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+241,75,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,95,118,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,118,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,241,75,
+0,0,0,0,0,0,0,0,0,0,0,0,98,8,246,92,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+95,118,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,118,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+246,92,98,8,0,0,0,0,0,0,0,0,130,8,92,118,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,127,126,127,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,127,109,127,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+92,118,130,8,0,0,0,0,0,0,0,0,0,0,237,50,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,190,126,255,117,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,95,109,95,109,95,109,255,117,190,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+237,50,0,0,0,0,0,0,0,0,0,0,0,0,32,0,
+185,109,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,158,126,255,117,127,109,95,109,
+95,109,95,109,95,109,95,109,95,109,95,109,95,109,95,109,
+95,109,127,109,255,117,158,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,185,109,
+32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+200,33,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,190,126,127,126,
+31,118,223,117,159,109,159,109,159,109,159,109,223,117,31,118,
+127,126,190,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,200,33,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,213,84,222,126,222,126,157,126,181,84,46,59,143,67,
+218,109,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,186,109,
+111,67,46,59,181,84,157,126,222,126,222,126,213,84,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,4,17,87,101,205,50,98,8,0,0,0,0,0,0,
+32,0,50,76,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,50,76,32,0,
+0,0,0,0,0,0,98,8,205,50,87,101,4,17,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,32,0,186,109,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,186,109,32,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,111,67,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,111,67,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,46,59,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,14,59,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,181,84,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,181,84,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,98,8,157,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,157,126,98,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,205,50,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,205,50,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,87,101,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,222,126,116,84,41,42,200,33,46,59,60,118,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+222,126,59,118,46,59,167,33,41,42,148,84,222,126,222,126,
+222,126,222,126,222,126,222,126,222,126,222,126,87,101,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,4,17,213,84,222,126,222,126,222,126,222,126,222,126,
+222,126,237,50,0,0,0,0,0,0,0,0,163,8,251,109,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+250,109,163,8,0,0,0,0,0,0,0,0,237,50,222,126,
+222,126,222,126,222,126,222,126,222,126,213,84,4,17,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,200,33,185,109,222,126,222,126,222,126,
+241,75,0,0,0,0,0,0,0,0,0,0,0,0,74,42,
+222,126,222,126,222,126,222,126,222,126,222,126,222,126,222,126,
+42,42,0,0,0,0,0,0,0,0,0,0,0,0,241,75,
+222,126,222,126,222,126,185,109,200,33,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,237,50,60,118,246,92,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,
+190,126,222,126,222,126,222,126,222,126,222,126,222,126,190,126,
+65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+246,92,60,118,237,50,32,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,98,8,98,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+250,109,222,126,222,126,222,126,222,126,222,126,222,126,250,109,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+98,8,98,8,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+214,92,222,126,222,126,222,126,222,126,222,126,222,126,214,92,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+177,67,222,126,222,126,222,126,222,126,222,126,222,126,177,67,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
\ No newline at end of file
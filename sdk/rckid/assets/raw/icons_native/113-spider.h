@@ -0,0 +1,517 @@
+// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets
+// Input file: "icons-native/113-spider.png"
+// Image:      64x64, 16 bpp, 0 palette colors
+// Size:       8200 bytes
+64,0,64,0,16,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,37,33,167,41,
+167,41,199,49,199,49,232,49,8,50,199,49,97,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,134,41,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,232,49,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,97,8,74,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,232,49,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,167,41,106,66,106,66,106,66,
+106,66,74,66,73,58,41,58,41,58,199,49,130,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,65,8,228,24,4,25,4,25,4,25,4,25,
+4,25,4,25,4,25,4,25,4,25,4,25,4,25,4,25,
+65,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,130,8,74,66,106,66,106,66,41,58,
+33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,37,33,73,58,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+41,58,32,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,167,41,106,66,106,66,106,66,37,33,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,65,8,102,41,167,41,167,41,167,41,167,41,
+167,41,167,41,167,41,167,41,134,41,195,16,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,16,
+8,58,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,36,25,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,130,16,106,66,106,66,106,66,41,58,32,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,130,16,41,58,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,74,66,97,8,0,0,
+0,0,0,0,0,0,0,0,0,0,65,8,167,41,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,8,50,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,199,49,106,66,106,66,106,66,4,25,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+228,24,73,58,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,162,16,0,0,
+0,0,0,0,0,0,0,0,195,16,73,58,106,66,106,66,
+106,66,106,66,74,66,134,41,163,16,163,16,163,16,163,16,
+163,16,163,16,163,16,163,16,163,16,163,16,232,49,106,66,
+106,66,106,66,130,8,0,0,0,0,0,0,0,0,0,0,
+0,0,130,16,106,66,106,66,106,66,41,58,32,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,33,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,74,66,166,41,0,0,0,0,
+0,0,0,0,0,0,0,0,41,58,106,66,106,66,106,66,
+106,66,232,49,130,16,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,4,25,106,66,
+106,66,106,66,102,33,0,0,0,0,0,0,0,0,0,0,
+0,0,199,49,106,66,106,66,106,66,4,25,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,134,41,106,66,
+106,66,106,66,106,66,9,58,130,8,32,0,32,0,32,0,
+32,0,32,0,32,0,32,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,232,49,106,66,106,66,73,58,
+4,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,32,0,73,58,
+106,66,106,66,41,58,0,0,0,0,0,0,0,0,0,0,
+162,16,106,66,106,66,106,66,41,58,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,199,49,106,66,106,66,
+106,66,106,66,232,49,32,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,97,8,134,41,69,33,65,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,41,
+106,66,106,66,106,66,195,16,0,0,0,0,0,0,0,0,
+69,33,106,66,106,66,106,66,4,25,0,0,0,0,0,0,
+0,0,0,0,0,0,65,8,8,50,106,66,106,66,106,66,
+106,66,134,41,32,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,16,
+106,66,106,66,106,66,167,41,0,0,0,0,0,0,0,0,
+195,16,106,66,106,66,106,66,69,33,0,0,0,0,0,0,
+0,0,0,0,130,16,41,58,106,66,106,66,106,66,106,66,
+69,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+41,58,106,66,106,66,74,66,33,0,0,0,0,0,0,0,
+32,0,73,58,106,66,106,66,8,58,0,0,0,0,0,0,
+0,0,162,16,73,58,106,66,106,66,106,66,73,58,228,24,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+69,33,106,66,106,66,106,66,4,25,0,0,0,0,0,0,
+0,0,167,41,106,66,106,66,106,66,97,8,0,0,0,0,
+0,0,199,49,106,66,106,66,106,66,73,58,162,16,0,0,
+0,0,0,0,0,0,0,0,162,16,228,24,228,24,228,24,
+228,24,228,24,228,24,228,24,228,24,195,16,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,65,8,134,41,171,66,
+78,83,82,108,83,116,18,108,143,91,8,50,130,16,0,0,
+0,0,4,25,106,66,106,66,106,66,4,25,0,0,0,0,
+0,0,8,58,106,66,106,66,73,58,97,8,0,0,0,0,
+0,0,0,0,0,0,102,41,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,232,49,65,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,32,0,232,49,241,99,245,124,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,50,108,
+74,58,130,16,106,66,106,66,106,66,199,49,0,0,0,0,
+0,0,8,58,106,66,106,66,41,58,0,0,0,0,0,0,
+0,0,0,0,134,41,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,73,58,
+195,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,73,58,115,116,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,180,116,110,83,106,66,106,66,74,66,32,0,0,0,
+0,0,8,58,106,66,106,66,41,58,0,0,0,0,0,0,
+0,0,102,41,106,66,106,66,106,66,106,66,106,66,106,66,
+106,66,106,66,106,66,106,66,106,66,106,66,106,66,106,66,
+74,66,69,33,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,8,
+143,83,208,91,17,100,245,124,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,115,116,171,74,106,66,227,24,0,0,
+0,0,8,58,106,66,106,66,41,58,0,0,0,0,0,0,
+102,41,106,66,106,66,106,66,106,66,134,41,195,16,195,16,
+195,16,195,16,195,16,195,16,4,25,73,58,106,66,106,66,
+106,66,106,66,199,49,65,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,130,8,208,91,
+208,91,208,91,208,91,17,100,245,124,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,245,124,13,83,134,41,0,0,
+195,16,106,66,171,74,171,74,138,66,195,16,0,0,102,33,
+106,66,106,66,106,66,106,66,134,41,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,97,8,232,49,106,66,
+106,66,106,66,106,66,199,49,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,65,0,143,83,208,91,
+208,91,208,91,208,91,208,91,49,100,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,245,124,13,83,203,74,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,171,74,
+106,66,106,66,106,66,134,41,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,41,
+106,66,106,66,106,66,41,58,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,13,75,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,115,108,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,82,116,13,83,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,138,66,134,41,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+228,24,73,58,74,66,4,25,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,167,33,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,245,124,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,49,108,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,102,41,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,32,0,32,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,65,0,143,83,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,82,108,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,115,116,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,4,25,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,200,41,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,245,124,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,245,124,13,83,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,204,74,134,41,102,41,102,41,102,41,
+69,33,65,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,46,75,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,147,116,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,240,107,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,171,74,106,66,106,66,106,66,
+106,66,232,49,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,162,16,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,50,100,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+22,133,13,83,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,106,66,106,66,106,66,
+106,66,73,58,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,102,33,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,241,91,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+147,116,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,138,66,106,66,106,66,
+74,66,4,25,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,36,33,74,66,74,66,74,66,
+74,66,74,66,46,83,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+17,108,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,41,58,65,8,65,8,
+32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,106,66,106,66,106,66,106,66,
+106,66,106,66,176,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+245,124,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+175,99,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,139,66,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,138,74,236,82,236,82,236,82,
+236,82,236,82,50,108,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+122,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+53,133,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,73,50,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,163,16,73,66,138,66,138,66,
+138,66,138,66,240,99,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,22,133,
+154,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+118,141,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,8,50,97,8,97,8,
+32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,232,49,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,54,133,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+248,157,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,45,83,236,82,236,82,
+236,82,69,33,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,195,16,22,133,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,119,141,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+154,174,241,99,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,236,82,236,82,236,82,
+236,82,203,74,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,83,108,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,248,157,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,21,125,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,110,83,236,82,236,82,236,82,
+236,82,73,66,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,138,66,22,133,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,22,133,122,166,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,122,166,241,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,175,83,8,50,199,49,199,49,199,49,
+134,41,65,8,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,65,8,180,124,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,119,141,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,183,149,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,101,33,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,41,58,22,133,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,22,133,89,166,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,118,141,208,91,208,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,208,91,232,41,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,32,0,32,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,208,99,22,133,22,133,
+22,133,22,133,22,133,22,133,22,133,151,149,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,155,174,183,149,241,91,208,91,208,91,
+208,91,208,91,208,91,208,91,208,91,208,91,208,91,208,91,
+208,91,45,83,232,49,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+36,33,203,74,236,82,69,33,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,65,8,180,116,22,133,
+22,133,22,133,22,133,22,133,54,133,154,174,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,57,166,175,91,143,83,
+208,91,208,91,208,91,208,91,208,91,208,91,175,83,110,83,
+12,83,236,82,236,82,232,49,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,32,0,231,49,
+236,82,236,82,236,82,203,74,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,130,8,245,124,
+22,133,22,133,22,133,54,133,90,166,155,174,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,155,174,122,166,207,99,8,50,0,0,
+4,25,45,75,110,83,110,83,45,83,4,25,0,0,167,49,
+236,82,236,82,236,82,236,82,232,49,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,98,8,106,66,236,82,
+236,82,236,82,236,82,73,58,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,8,
+180,124,22,133,54,133,90,166,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,248,157,142,91,236,82,36,25,0,0,
+0,0,138,66,236,82,236,82,171,74,0,0,0,0,0,0,
+199,49,236,82,236,82,236,82,236,82,232,49,4,25,4,25,
+4,25,4,25,4,25,4,25,69,33,203,74,236,82,236,82,
+236,82,236,82,73,58,65,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,13,83,183,149,155,174,155,174,155,174,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,155,174,
+155,174,89,166,146,124,12,83,236,82,236,82,65,0,0,0,
+0,0,138,66,236,82,236,82,171,74,0,0,0,0,0,0,
+0,0,167,49,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,134,41,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,32,0,138,66,53,133,154,174,155,174,155,174,
+155,174,155,174,155,174,155,174,155,174,155,174,155,174,215,149,
+45,83,4,25,236,82,236,82,236,82,73,58,0,0,0,0,
+0,0,138,66,236,82,236,82,171,74,0,0,0,0,0,0,
+0,0,0,0,199,49,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,203,74,
+227,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,195,16,73,58,174,91,
+146,124,183,149,183,149,118,149,244,132,203,66,36,25,0,0,
+0,0,102,41,236,82,236,82,236,82,69,33,0,0,0,0,
+0,0,138,66,236,82,236,82,204,74,130,16,0,0,0,0,
+0,0,0,0,0,0,199,49,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,106,66,97,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+134,41,236,82,236,82,236,82,69,33,0,0,0,0,0,0,
+0,0,73,66,236,82,236,82,236,82,97,8,0,0,0,0,
+0,0,73,58,236,82,236,82,236,82,203,74,227,24,0,0,
+0,0,0,0,0,0,0,0,195,16,36,33,36,33,36,33,
+36,33,36,33,36,33,36,33,36,33,228,24,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+171,74,236,82,236,82,236,82,65,8,0,0,0,0,0,0,
+32,0,236,82,236,82,236,82,138,66,0,0,0,0,0,0,
+0,0,195,16,204,82,236,82,236,82,236,82,236,82,69,33,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,24,
+236,82,236,82,236,82,8,58,0,0,0,0,0,0,0,0,
+4,25,236,82,236,82,236,82,134,41,0,0,0,0,0,0,
+0,0,0,0,162,16,171,74,236,82,236,82,236,82,236,82,
+166,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,98,8,200,49,167,49,97,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,49,
+236,82,236,82,236,82,4,25,0,0,0,0,0,0,0,0,
+134,41,236,82,236,82,236,82,69,33,0,0,0,0,0,0,
+0,0,0,0,0,0,97,8,138,66,236,82,236,82,236,82,
+236,82,8,58,32,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,106,66,236,82,236,82,203,74,
+69,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,32,0,204,74,
+236,82,236,82,171,74,0,0,0,0,0,0,0,0,0,0,
+195,16,236,82,236,82,236,82,171,74,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,33,0,41,58,236,82,236,82,
+236,82,236,82,73,66,65,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,171,74,236,82,236,82,236,82,
+236,82,106,66,195,16,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,37,33,236,82,
+236,82,236,82,167,49,0,0,0,0,0,0,0,0,0,0,
+0,0,41,58,236,82,236,82,236,82,69,33,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,231,49,236,82,
+236,82,236,82,236,82,139,74,130,16,32,0,32,0,32,0,
+32,0,32,0,32,0,32,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4,25,203,74,236,82,236,82,
+236,82,236,82,236,82,200,49,227,24,227,24,227,24,227,24,
+227,24,227,24,227,24,227,24,227,24,227,24,106,66,236,82,
+236,82,236,82,162,16,0,0,0,0,0,0,0,0,0,0,
+0,0,162,16,236,82,236,82,236,82,171,74,32,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,41,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,232,49,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,97,8,8,58,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,106,66,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8,58,236,82,236,82,236,82,101,33,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+4,25,204,74,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,195,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,228,24,
+138,66,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+236,82,101,33,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,162,16,236,82,236,82,236,82,171,74,32,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,163,16,171,74,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,97,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,134,41,204,82,236,82,236,82,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,236,82,236,82,
+171,74,65,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,232,49,236,82,236,82,236,82,102,41,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,97,8,199,49,8,58,8,58,8,58,8,58,
+8,58,8,58,8,58,8,58,232,49,227,24,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,97,8,36,33,69,33,69,33,69,33,69,33,
+69,33,69,33,69,33,69,33,69,33,69,33,69,33,37,33,
+97,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,130,8,236,82,236,82,236,82,203,74,
+65,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8,58,236,82,236,82,236,82,
+236,82,236,82,204,74,171,74,171,74,73,58,130,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,130,8,236,82,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,73,66,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,199,49,236,82,236,82,
+236,82,236,82,236,82,236,82,236,82,236,82,73,66,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,32,0,102,41,8,58,
+8,58,41,58,73,66,106,66,106,66,73,58,130,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
\ No newline at end of file
@@ -0,0 +1,517 @@
+// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets
+// Input file: "icons-native/118-applications.png"
+// Image:      64x64, 16 bpp, 0 palette colors
+// Size:       8200 bytes
+64,0,64,0,16,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,162,32,203,154,207,219,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,207,219,170,154,97,24,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,162,32,207,219,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,207,219,97,24,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,203,162,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,170,154,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,239,219,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,207,219,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+243,236,85,237,20,229,243,212,178,204,215,213,215,213,215,213,
+215,213,215,213,215,213,215,213,247,221,52,229,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+57,93,57,93,57,93,57,93,57,93,216,84,112,59,130,8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+85,245,52,245,52,245,52,245,52,245,186,246,56,230,215,213,
+215,213,215,213,215,213,215,213,215,213,247,221,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,183,84,
+130,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,52,245,52,245,219,254,219,254,154,246,
+24,222,215,213,215,213,215,213,215,213,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+112,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,219,254,219,254,219,254,
+219,254,219,254,52,245,52,245,52,245,219,254,219,254,219,254,
+219,246,24,222,215,213,215,213,215,213,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+216,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,219,254,219,254,219,254,
+219,254,219,254,52,245,52,245,52,245,219,254,219,254,219,254,
+52,245,52,237,24,222,215,213,215,213,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+57,93,57,93,57,93,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,52,245,52,245,219,254,219,254,219,254,
+52,245,52,245,219,246,24,222,215,213,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,184,68,181,11,84,3,51,3,
+18,3,18,3,18,3,18,3,116,11,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,52,245,52,245,219,254,219,254,219,254,
+219,254,219,254,219,254,154,246,215,213,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,182,11,149,3,149,3,149,3,
+117,3,19,3,18,3,18,3,216,76,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,52,245,52,245,219,254,219,254,219,254,
+219,254,219,254,219,254,219,254,56,230,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,51,3,54,44,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,52,245,52,245,219,254,219,254,219,254,
+52,245,52,245,219,254,219,254,186,246,215,213,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,219,254,219,254,219,254,
+219,254,219,254,52,245,52,245,52,245,219,254,219,254,219,254,
+52,245,52,245,219,254,219,254,219,254,24,222,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,219,254,219,254,219,254,
+219,254,219,254,52,245,52,245,52,245,219,254,219,254,219,254,
+219,254,219,254,219,254,24,246,211,220,113,204,113,204,146,212,
+146,228,48,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,52,245,52,245,219,254,219,254,219,254,
+219,254,186,254,117,245,52,245,52,237,243,228,146,212,113,204,
+113,204,146,212,48,228,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+85,245,52,245,52,245,52,245,52,245,219,254,219,254,219,254,
+219,254,117,245,52,245,52,245,52,245,52,245,20,237,178,220,
+113,204,113,204,146,212,48,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+243,236,85,245,52,245,52,245,52,245,219,254,219,254,219,254,
+56,246,52,245,52,245,52,245,52,245,52,245,85,245,215,245,
+178,220,113,204,113,204,146,228,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+243,236,52,245,52,245,52,245,52,245,85,245,154,246,219,254,
+215,245,178,220,113,204,146,212,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,57,93,57,93,57,93,57,93,57,93,
+57,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,219,254,219,254,219,254,219,254,154,246,
+85,245,20,237,146,212,113,204,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,182,11,151,68,155,198,251,222,
+219,222,186,214,121,206,56,198,247,189,247,189,247,189,247,189,
+247,189,247,189,247,189,247,189,247,189,247,189,247,189,247,189,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+52,245,52,245,52,245,219,254,219,254,219,254,154,246,85,245,
+52,245,52,245,243,228,113,204,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,184,68,187,206,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,121,206,24,198,247,189,
+247,189,247,189,247,189,247,189,247,189,247,189,247,189,247,189,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+243,236,52,245,52,245,52,245,52,245,52,245,52,245,52,245,
+52,245,52,245,52,237,146,220,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,154,214,
+24,198,247,189,247,189,247,189,247,189,247,189,247,189,247,189,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+146,236,52,245,52,245,52,245,52,245,52,245,52,245,52,245,
+52,245,52,245,52,245,146,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,89,206,247,189,20,165,20,165,247,189,247,189,247,189,
+20,165,20,165,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+48,236,243,236,52,245,52,245,52,245,52,245,52,245,52,245,
+52,245,52,245,243,236,48,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,24,198,89,206,154,214,
+251,222,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,154,214,20,165,20,165,247,189,247,189,247,189,
+20,165,20,165,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,48,236,243,236,52,245,52,245,52,245,52,245,52,245,
+52,245,243,236,48,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,247,189,247,189,247,189,
+89,206,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,186,214,247,189,247,189,247,189,247,189,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,48,236,146,236,243,236,20,245,20,245,243,236,
+146,236,48,236,16,236,16,236,16,236,16,236,16,236,16,236,
+57,93,57,93,57,93,57,93,57,93,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,186,214,247,189,247,189,247,189,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,239,219,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,207,219,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,251,222,247,189,247,189,154,214,247,189,247,189,
+20,165,20,165,0,0,0,0,0,0,0,0,0,0,0,0,
+131,0,110,2,209,163,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,203,154,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,251,222,247,189,247,189,251,222,89,206,247,189,
+20,165,20,165,0,0,0,0,0,0,0,0,0,0,131,0,
+84,3,149,3,181,35,16,220,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,207,219,162,32,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,24,198,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,111,2,
+149,3,149,3,149,3,181,35,242,163,16,220,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,16,236,16,236,16,236,16,236,
+16,236,16,236,16,236,16,236,239,219,203,162,162,32,0,0,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,154,214,
+247,189,247,189,0,0,0,0,0,0,0,0,0,0,84,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+84,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,251,222,247,189,247,189,251,222,251,222,251,222,
+52,165,20,165,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,251,222,247,189,247,189,251,222,251,222,251,222,
+150,181,20,165,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+247,189,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,247,189,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,247,189,247,189,247,189,
+89,206,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,56,198,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,152,60,189,182,29,207,29,207,
+29,207,253,198,220,198,123,190,58,182,25,174,25,174,25,174,
+25,174,25,174,25,174,248,92,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,0,0,194,0,202,3,
+78,5,143,5,143,5,143,5,143,5,24,198,89,206,154,214,
+251,222,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,251,222,247,189,247,189,251,222,251,222,251,222,
+247,189,117,173,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,189,182,29,207,29,207,29,207,
+29,207,29,207,29,207,29,207,29,207,188,198,58,182,25,174,
+25,174,25,174,25,174,25,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,194,0,45,5,143,5,
+143,5,143,5,143,5,143,5,143,5,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,247,189,247,189,
+251,222,251,222,251,222,247,189,247,189,251,222,251,222,251,222,
+247,189,182,181,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,29,207,
+29,207,29,207,29,207,29,207,29,207,29,207,29,207,90,182,
+25,174,25,174,25,174,25,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,202,3,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,219,222,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,57,93,
+57,93,29,207,29,207,57,93,57,93,29,207,29,207,57,93,
+247,108,25,174,25,174,25,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,78,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,218,198,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,57,93,
+57,93,29,207,29,207,57,93,57,93,29,207,29,207,57,93,
+57,93,91,182,25,174,25,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,85,110,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,251,222,251,222,251,222,251,222,251,222,251,222,
+251,222,251,222,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,57,93,
+57,93,29,207,29,207,57,93,57,93,29,207,29,207,57,93,
+57,93,29,207,57,182,25,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,58,175,123,191,123,191,
+123,191,249,182,87,166,87,166,119,166,175,5,175,5,175,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,57,93,
+57,93,29,207,29,207,57,93,57,93,29,207,29,207,57,93,
+57,93,29,207,188,198,25,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,26,183,87,166,87,166,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,57,93,
+57,93,29,207,29,207,57,93,57,93,29,207,29,207,57,93,
+57,93,29,207,29,207,58,174,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,249,182,87,166,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,57,93,
+57,93,29,207,29,207,57,93,57,93,29,207,29,207,57,93,
+57,93,29,207,29,207,123,190,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,123,191,120,166,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,29,207,29,207,29,207,29,207,
+29,207,29,207,29,207,29,207,29,207,29,207,29,207,29,207,
+29,207,29,207,29,207,188,198,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,123,191,249,182,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,189,182,29,207,29,207,29,207,
+29,207,29,207,29,207,29,207,29,207,29,207,29,207,29,207,
+29,207,29,207,29,207,188,182,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,123,191,58,191,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,152,60,189,182,29,207,29,207,
+29,207,29,207,29,207,29,207,29,207,29,207,29,207,29,207,
+29,207,29,207,189,182,152,60,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,123,191,91,191,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,123,191,123,191,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,123,191,123,191,123,191,
+123,191,123,191,123,191,123,191,123,191,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,58,175,123,191,123,191,
+123,191,123,191,123,191,123,191,58,175,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+84,3,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,18,62,58,175,123,191,
+123,191,123,191,123,191,58,175,18,54,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,2,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+110,2,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,208,21,116,94,
+116,94,116,94,116,94,208,21,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,
+84,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,84,3,
+131,0,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,51,70,116,94,
+116,94,116,94,116,94,51,70,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+131,0,111,2,84,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,149,3,149,3,149,3,
+149,3,149,3,149,3,149,3,149,3,84,3,111,2,131,0,
+0,0,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,208,21,116,94,116,94,
+116,94,116,94,116,94,116,94,208,21,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,208,21,116,86,116,94,
+116,94,116,94,116,94,116,86,208,21,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,78,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,78,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,234,3,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,202,3,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,226,0,45,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,45,5,194,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,226,0,234,3,
+78,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,143,5,143,5,143,5,143,5,143,5,143,5,143,5,
+143,5,78,5,202,3,194,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
\ No newline at end of file
@@ -11,6 +11,38 @@
  */
 #define UART_TX_TIMEOUT_US 200000
 
+/** Size of the scratch arena every app gets for per-frame temporaries, see App::frameScratch(). 
+ */
+#ifndef RCKID_FRAME_SCRATCH_SIZE
+#define RCKID_FRAME_SCRATCH_SIZE 4096
+#endif
+
+/** Maximum number of sprites a UI tile engine can have. The sprites are allocated from a pool of that size.
+ */
+#ifndef RCKID_UI_MAX_SPRITES
+#define RCKID_UI_MAX_SPRITES 32
+#endif
+
+/** Bitmap renderers only send the dirty part of the bitmap to the display, unless it covers at least this percentage of the bitmap, in which case the whole bitmap is sent, which is faster as it can be done in a single transfer.
+ */
+#ifndef RCKID_DISPLAY_FULL_UPDATE_PERCENT
+#define RCKID_DISPLAY_FULL_UPDATE_PERCENT 60
+#endif
+
+/** Number of columns the column renderers convert into a single chunk that is sent to the display in one transfer, and the number of chunk buffers they cycle through, see RenderPipeline. More columns per chunk mean fewer display transfers (and their IRQs) per frame, more buffers let the rendering get further ahead of the display, both at the expense of RAM (2 bytes per pixel of column height for each column in every buffer).
+ */
+#ifndef RCKID_RENDER_CHUNK_COLUMNS
+#define RCKID_RENDER_CHUNK_COLUMNS 4
+#endif
+
+#ifndef RCKID_RENDER_BUFFERS
+#define RCKID_RENDER_BUFFERS 3
+#endif
+
+/** When defined, the allocator keeps a histogram of allocation sizes, live & peak bytes per arena and on the fantasy console also the allocation sites. See memoryProfileDump(). Best enabled from cmake via -DRCKID_MEMORY_PROFILER.
+ */
+//#define RCKID_MEMORY_PROFILER
+
 // backend specific configuration, which may override the general configuration above
 #include "backend_config.h"
 
@@ -1,10 +1,14 @@
 #pragma once
+#include <algorithm>
 #include <type_traits>
 
 #include "../rckid.h"
 #include "drawing.h"
 #include "font.h"
+#include "glyph_cache.h"
+#include "image_asset.h"
 #include "png.h"
+#include "render_pipeline.h"
 
 namespace rckid {
 
@@ -21,13 +25,15 @@ namespace rckid {
         static_assert(BPP == 16 || BPP ==8 || BPP == 4);
 
         Surface() = default;
-        Surface(Coord width, Coord height): w_{width}, h_{height}, buffer_{allocateBuffer(width, height) } {}
+        Surface(Coord width, Coord height): w_{width}, h_{height}, buffer_{allocateBuffer(width, height) }, dirty_{Rect::WH(width, height)} {}
 
         Surface(Surface const &) = delete;
         Surface(Surface && from): 
             w_{from.w_}, 
             h_{from.h_}, 
-            buffer_{from.buffer_} 
+            buffer_{from.buffer_},
+            ownsBuffer_{from.ownsBuffer_},
+            dirty_{from.dirty_}
         {
             from.w_ = 0;
             from.h_ = 0;
@@ -35,18 +41,35 @@ namespace rckid {
         }
 
         ~Surface() {
-            delete [] buffer_;
+            if (ownsBuffer_)
+                delete [] buffer_;
         }
 
         Surface & operator = (Surface && from) {
             w_ = from.w_;
             h_ = from.h_;
-            delete buffer_;
+            if (ownsBuffer_)
+                delete [] buffer_;
             buffer_ = from.buffer_;
+            ownsBuffer_ = from.ownsBuffer_;
+            dirty_ = from.dirty_;
             from.buffer_ = nullptr;
             return *this;
         }
 
+        /** Creates surface from the native image asset.
+
+            If the asset is not compressed, the surface points straight to the pixel data of the asset, which on the device lives in flash, so there is no decoding and no heap copy. Such surface does not own its buffer and is read-only, i.e. it can be blitted and rendered, but must not be drawn on, which is checked by the drawing operations and by the non-const buffer(). Compressed assets are decompressed into a newly allocated buffer instead. 
+         */
+        static Surface fromAsset(ImageAsset const & asset) {
+            ASSERT(asset.bpp() == BPP);
+            if (!asset.compressed())
+                return Surface{asset.width(), asset.height(), const_cast<uint8_t *>(asset.pixels()), false};
+            Surface result{asset.width(), asset.height()};
+            asset.decompress(result.buffer_);
+            return result;
+        }
+
         Coord width() const { return w_; }
         Coord height() const { return h_; }
 
@@ -54,9 +77,41 @@ namespace rckid {
 
         /** Returns the color buffer. 
          
+            The mutable buffer is only available for surfaces that own their buffer (see fromAsset()). As the surface cannot know what will be written to it, taking the mutable buffer marks the entire surface dirty. Code that keeps the buffer pointer across frames must call markDirty() itself.
          */
         uint8_t const * buffer() const { return buffer_; }
-        uint8_t * buffer() { return buffer_; }
+        uint8_t * buffer() { 
+            ASSERT(ownsBuffer_);
+            markDirty();
+            return buffer_; 
+        }
+
+        /** Returns true if the surface owns its pixel buffer, false if it only wraps read-only pixels of an image asset.
+         */
+        bool ownsBuffer() const { return ownsBuffer_; }
+
+        /** \name Dirty region
+
+            All drawing operations of the surface mark the area they have changed as dirty, which allows the renderers to only send the changed part of the display. The dirty region is the bounding rectangle of all changes since it was last cleared. Newly created surfaces are dirty in their entirety, and so is a surface whose mutable buffer() has been taken.
+
+            The dirty region is bookkeeping only and can be cleared by the renderers of const surfaces.
+         */
+        //@{
+
+        Rect dirtyRect() const { return dirty_; }
+
+        bool dirty() const { return !dirty_.empty(); }
+
+        /** Adds the given rectangle, clipped to the surface, to the dirty region.
+         */
+        void markDirty(Rect rect) const { dirty_ = dirty_.unitedWith(rect.intersectedWith(Rect::WH(w_, h_))); }
+
+        /** Marks the entire surface as dirty.
+         */
+        void markDirty() const { dirty_ = Rect::WH(w_, h_); }
+
+        void clearDirty() const { dirty_ = Rect{}; }
+        //@}
 
         /** \name Per-pixel interface 
 
@@ -66,7 +121,11 @@ namespace rckid {
 
         Color pixelAt(Coord x, Coord y) const { return pixelBufferAt<COLOR>(buffer_, x, y, w_, h_); }
 
-        void setPixelAt(Coord x, Coord y, Color c) { setPixelBufferAt<COLOR>(buffer_, x, y, c, w_, h_); }
+        void setPixelAt(Coord x, Coord y, Color c) { 
+            ASSERT(ownsBuffer_);
+            setPixelBufferAt<COLOR>(buffer_, x, y, c, w_, h_); 
+            markDirty(Rect::XYWH(x, y, 1, 1));
+        }
         //@}
 
         /** \name Blitting 
@@ -75,13 +134,48 @@ namespace rckid {
 
         void blit(Point where, Surface const & src) { blit(where, src, Rect::WH(src.width(), src.height())); }
 
+        /** Copies the given rectangle of the source surface to the specified position.
+
+            The rectangle is clipped against both surfaces once, after which each column of the rectangle is a contiguous run of pixels in both buffers and is copied in one go via pixelBufferCopy().
+         */
         void blit(Point where, Surface const & src, Rect srcRect) {
-            // default, very slow implementation 
-            int dy = where.y;
-            for (int y = srcRect.top(), ye = srcRect.bottom(); y != ye; ++y, ++dy) {
-                int dx = where.x;
-                for (int x = srcRect.left(), xe = srcRect.right(); x != xe; ++x, ++dx)
-                    setPixelAt(dx, dy, src.pixelAt(x, y));
+            ASSERT(ownsBuffer_);
+            // clip to the source surface
+            if (srcRect.x < 0) {
+                where.x -= srcRect.x;
+                srcRect.w += srcRect.x;
+                srcRect.x = 0;
+            }
+            if (srcRect.y < 0) {
+                where.y -= srcRect.y;
+                srcRect.h += srcRect.y;
+                srcRect.y = 0;
+            }
+            srcRect.w = std::min(srcRect.w, src.width() - srcRect.x);
+            srcRect.h = std::min(srcRect.h, src.height() - srcRect.y);
+            // clip to the target surface
+            if (where.x < 0) {
+                srcRect.x -= where.x;
+                srcRect.w += where.x;
+                where.x = 0;
+            }
+            if (where.y < 0) {
+                srcRect.y -= where.y;
+                srcRect.h += where.y;
+                where.y = 0;
+            }
+            srcRect.w = std::min(srcRect.w, w_ - where.x);
+            srcRect.h = std::min(srcRect.h, h_ - where.y);
+            if (srcRect.w <= 0 || srcRect.h <= 0)
+                return;
+            markDirty(Rect::XYWH(where, srcRect.w, srcRect.h));
+            // copy the columns, moving to the previous column in the buffer means subtracting the height
+            uint32_t srcOffset = pixelBufferOffset(srcRect.x, srcRect.y, src.width(), src.height());
+            uint32_t dstOffset = map(where.x, where.y);
+            for (Coord i = 0; i < srcRect.w; ++i) {
+                pixelBufferCopy<COLOR>(buffer_, dstOffset, src.buffer(), srcOffset, srcRect.h);
+                srcOffset -= src.height();
+                dstOffset -= h_;
             }
         }
         //@}
@@ -90,49 +184,96 @@ namespace rckid {
          */
         //@{
 
-        void fill(Color color) { pixelBufferFill<Color>(buffer_, numPixels(), color); }
+        void fill(Color color) { 
+            ASSERT(ownsBuffer_);
+            pixelBufferFill<Color>(buffer_, numPixels(), color); 
+            markDirty();
+        }
+
+        /** Fills the given rectangle with a color.
 
+            The rectangle is clipped once and then each of its columns, which is a contiguous run of pixels in the buffer, is filled via pixelBufferFill().
+         */
         void fill(Color color, Rect rect) {
-            // default, very slow implementation
-            for (int x = rect.left(), xe = rect.right(); x < xe; ++x)
-                for (int y = rect.top(), ye = rect.bottom(); y < ye; ++y)
-                    setPixelAt(x, y, color);
+            ASSERT(ownsBuffer_);
+            Coord xs = std::max(rect.left(), 0);
+            Coord xe = std::min(rect.right(), w_);
+            Coord ys = std::max(rect.top(), 0);
+            Coord ye = std::min(rect.bottom(), h_);
+            if (xs >= xe || ys >= ye)
+                return;
+            markDirty(Rect::XYWH(xs, ys, xe - xs, ye - ys));
+            uint32_t offset = map(xs, ys);
+            for (Coord x = xs; x < xe; ++x, offset -= h_)
+                pixelBufferFill<Color>(buffer_, offset, ye - ys, color);
         }
 
-        int putChar(Point where, Font const & font, char c, Color const * colors) {
+        /** Draws single character at given position and returns its advance.
+
+            The glyph is clipped once and each of its visible columns is then written directly to the column in the buffer. If a glyph cache is provided, the glyph's unpacked pixels are taken from it, otherwise the packed pixels are decoded on the fly, skipping over words of transparent pixels.
+         */
+        int putChar(Point where, Font const & font, char c, Color const * colors, GlyphCache * cache = nullptr) {
+            ASSERT(ownsBuffer_);
             if (where.x > width())
                 return 0;
             GlyphInfo const & g = font.glyphs[static_cast<uint8_t>((c - 32 >= 0) ? (c - 32) : 0)];
-            if (where.x + g.advanceX < 0)
+            int gx = where.x + g.x;
+            int gy = where.y + g.y;
+            int xs = std::max(gx, 0);
+            int xe = std::min(gx + g.width, w_);
+            int ys = std::max(gy, 0);
+            int ye = std::min(gy + g.height, h_);
+            if (xs >= xe || ys >= ye)
                 return g.advanceX;
-            uint32_t const * pixels = font.pixels + g.index;
-            int ys = where.y + g.y;
-            int ye = ys + g.height;
-            for (int x = where.x + g.x,xe = where.x + g.x + g.width; x < xe; ++x) {
-                uint32_t col;
-                uint32_t bits = 0;
-                for (int y = ys; y != ye; ++y) {
-                    if (bits == 0) {
-                        bits = 32;
-                        col = *pixels++;
+            markDirty(Rect::XYWH(xs, ys, xe - xs, ye - ys));
+            int n = ye - ys;
+            uint32_t offset = map(xs, ys);
+            if (cache != nullptr) {
+                uint8_t const * pixels = cache->get(font, g) + (xs - gx) * g.height + (ys - gy);
+                for (int x = xs; x < xe; ++x, offset -= h_, pixels += g.height) {
+                    for (int i = 0; i < n; ++i) {
+                        unsigned a = pixels[i];
+                        if (a != 0)
+                            setPixelBufferAt<Color>(buffer_, offset + i, colors[a]);
+                    }
+                }
+            } else {
+                // every column starts at a new word, 16 pixels per word
+                int wordsPerColumn = (g.height + 15) / 16;
+                int skip = ys - gy;
+                uint32_t const * pixels = font.pixels + g.index + (xs - gx) * wordsPerColumn + skip / 16;
+                for (int x = xs; x < xe; ++x, offset -= h_, pixels += wordsPerColumn) {
+                    uint32_t const * p = pixels;
+                    uint32_t col = *p++ << ((skip % 16) * 2);
+                    int left = 16 - skip % 16;
+                    for (int i = 0; i < n; ) {
+                        if (left == 0) {
+                            col = *p++;
+                            left = 16;
+                        }
+                        if (col == 0) {
+                            i += left;
+                            left = 0;
+                            continue;
+                        }
+                        unsigned a = col >> 30;
+                        if (a != 0)
+                            setPixelBufferAt<Color>(buffer_, offset + i, colors[a]);
+                        col = col << 2;
+                        --left;
+                        ++i;
                     }
-                    unsigned a = (col >> 30) & 0x3;
-                    if (a != 0)
-                        setPixelAt(x, y, colors[a]);
-                    col = col << 2;
-                    bits -= 2;
                 }
             }
             return g.advanceX;
         }
 
-
-        Writer text(int x, int y, Font const & font, Color const * colors) {
+        Writer text(int x, int y, Font const & font, Color const * colors, GlyphCache * cache = nullptr) {
             int startX = x;
             return Writer{[=](char c) mutable {
                 if (c != '\n') {
                     if (x < width())
-                        x += putChar(Point{x, y}, font, c, colors);
+                        x += putChar(Point{x, y}, font, c, colors, cache);
                 } else {
                     x = startX;
                     y += font.size;
@@ -140,13 +281,13 @@ namespace rckid {
             }};
         }
 
-        Writer text(int x, int y, Font const & font, Color color) {
+        Writer text(int x, int y, Font const & font, Color color, GlyphCache * cache = nullptr) {
             Color colors[] = { color, (color + 1), (color + 2) , (color + 3) };
             int startX = x;
-            return Writer{[this, x, y, startX, font, colors](char c) mutable {
+            return Writer{[this, x, y, startX, font, colors, cache](char c) mutable {
                 if (c != '\n') {
                     if (x < width())
-                        x += putChar(Point{x, y}, font, c, colors);
+                        x += putChar(Point{x, y}, font, c, colors, cache);
                 } else {
                     x = startX;
                     y += font.size;
@@ -162,14 +303,74 @@ namespace rckid {
          */
         //@{
 
-        void loadImage(PNG && png, Point where = Point::origin()) {
-            ASSERT(png.width() <= width());
-            ASSERT(png.height() <= height());
-            ASSERT(buffer_ != nullptr);
-            png.decode([&](ColorRGB * line, int lineNum, int lineWidth){
-                for (int i = 0; i < lineWidth; ++i)
-                    setPixelAt(i + where.x, lineNum + where.y, line[i]);
-            });
+        /** Loads the PNG image to given position, clipping it to the surface.
+
+            The decoded lines are transposed to the native column-major layout through a small tile of IMAGE_TILE_ROWS lines, whose columns are then copied to the surface as contiguous runs. RGB surfaces can load any image, while palette surfaces only accept indexed images, whose palette indices are stored directly without going through RGB (use PNG::palette() to obtain the colors).
+
+            If alphaBlend is true, the image is alpha-composited over the existing contents of the surface instead. This is only supported for RGB surfaces and as every pixel has to be read anyway, the lines are written directly.
+         */
+        void loadImage(PNG && png, Point where = Point::origin(), bool alphaBlend = false) {
+            ASSERT(buffer_ != nullptr && ownsBuffer_);
+            int xs = std::max(where.x, 0);
+            int xe = std::min(where.x + png.width(), w_);
+            if (xs >= xe)
+                return;
+            int n = xe - xs;
+            int sx = xs - where.x;
+            markDirty(Rect::XYWH(xs, where.y, n, png.height()));
+            if constexpr (BPP == 16) {
+                if (alphaBlend) {
+                    png.decode(PNG::DecodeAlphaCallback{[&](ColorRGB * line, uint8_t const * alpha, int lineNum, int) {
+                        int y = where.y + lineNum;
+                        if (y < 0 || y >= h_)
+                            return;
+                        ColorRGB * pixels = reinterpret_cast<ColorRGB *>(buffer_);
+                        uint32_t offset = map(xs, y);
+                        for (int i = 0; i < n; ++i, offset -= h_) {
+                            uint8_t a = (alpha == nullptr) ? 255 : alpha[sx + i];
+                            if (a == 255)
+                                pixels[offset] = line[sx + i];
+                            else if (a != 0)
+                                pixels[offset] = line[sx + i].blendOver(pixels[offset], a);
+                        }
+                    }});
+                    return;
+                }
+            } else {
+                ASSERT(!alphaBlend);
+                ASSERT(png.indexed() && png.bpp() <= BPP);
+            }
+            uint8_t * tile = new uint8_t[pixelBufferSize<COLOR>(n, IMAGE_TILE_ROWS)];
+            int tileY = 0;
+            int rows = 0;
+            auto flush = [&]() {
+                uint32_t offset = map(xs, tileY);
+                for (int i = 0; i < n; ++i, offset -= h_)
+                    pixelBufferCopy<COLOR>(buffer_, offset, tile, i * IMAGE_TILE_ROWS, rows);
+                rows = 0;
+            };
+            auto addLine = [&](auto const * line, int lineNum) {
+                int y = where.y + lineNum;
+                if (y < 0 || y >= h_)
+                    return;
+                if (rows == 0)
+                    tileY = y;
+                for (int i = 0; i < n; ++i) {
+                    if constexpr (BPP == 16)
+                        setPixelBufferAt<COLOR>(tile, i * IMAGE_TILE_ROWS + rows, line[sx + i]);
+                    else
+                        setPixelBufferAt<COLOR>(tile, i * IMAGE_TILE_ROWS + rows, COLOR::fromRaw(line[sx + i]));
+                }
+                if (++rows == IMAGE_TILE_ROWS)
+                    flush();
+            };
+            if constexpr (BPP == 16)
+                png.decode(PNG::DecodeCallback{[&](ColorRGB * line, int lineNum, int) { addLine(line, lineNum); }});
+            else
+                png.decode(PNG::DecodeIndexedCallback{[&](uint8_t const * line, int lineNum, int) { addLine(line, lineNum); }});
+            if (rows > 0)
+                flush();
+            delete [] tile;
         }
 
         static Surface fromImage(PNG && png) {
@@ -181,6 +382,12 @@ namespace rckid {
 
     private:
 
+        Surface(Coord width, Coord height, uint8_t * buffer, bool ownsBuffer): w_{width}, h_{height}, buffer_{buffer}, ownsBuffer_{ownsBuffer}, dirty_{Rect::WH(width, height)} {}
+
+        /** Number of image lines that are transposed at once when loading images.
+         */
+        static constexpr int IMAGE_TILE_ROWS = 8;
+
         constexpr uint8_t * allocateBuffer(int w, int h) {
             if (w == 0 || h == 0)
                 return nullptr;
@@ -193,11 +400,13 @@ namespace rckid {
         Coord h_ = 0;
 
         uint8_t * buffer_ = nullptr;
+        bool ownsBuffer_ = true;
+        mutable Rect dirty_;
 
     }; // rckid::Surface
 
     template<>
-    inline Writer Surface<ColorRGB>::text(int x, int y, Font const & font, ColorRGB color) {
+    inline Writer Surface<ColorRGB>::text(int x, int y, Font const & font, ColorRGB color, GlyphCache * cache) {
         Color colors[] = {
             color.withAlpha(0), 
             color.withAlpha(85), 
@@ -205,10 +414,10 @@ namespace rckid {
             color.withAlpha(255), 
         };
         int startX = x;
-        return Writer{[this, x, startX, y, font, colors](char c) mutable {
+        return Writer{[this, x, startX, y, font, colors, cache](char c) mutable {
             if (c != '\n') {
                 if (x < width())
-                    x += putChar(Point{x, y}, font, c, colors);
+                    x += putChar(Point{x, y}, font, c, colors, cache);
             } else {
                 x = startX;
                 y += font.size;
@@ -230,12 +439,44 @@ namespace rckid {
         Bitmap(Bitmap const &) = delete;
         Bitmap(Bitmap && from) = default;
 
+        /** Creates bitmap from the native image asset, using the asset's palette, if any. See Surface::fromAsset() for details.
+         */
+        static Bitmap fromAsset(ImageAsset const & asset) {
+            Bitmap result{Surface<COLOR>::fromAsset(asset)};
+            if constexpr (COLOR::BPP != 16)
+                result.setPalette(asset.palette());
+            return result;
+        }
+
+    private:
+
+        Bitmap(Surface<COLOR> && from): Surface<COLOR>{std::move(from)} {}
+
     }; // rckid::Bitmap
 
 
+    /** Returns the part of the surface that has to be sent to the display, i.e. its dirty region, or the entire surface if the dirty region covers at least RCKID_DISPLAY_FULL_UPDATE_PERCENT of it. For 4 bpp colors the rows are extended to whole bytes. 
+     */
+    template<typename COLOR>
+    inline Rect displayUpdateRect(Surface<COLOR> const & surface) {
+        Rect dirty = surface.dirtyRect();
+        if (dirty.empty())
+            return dirty;
+        if (static_cast<uint32_t>(dirty.area()) * 100 >= surface.numPixels() * RCKID_DISPLAY_FULL_UPDATE_PERCENT)
+            return Rect::WH(surface.width(), surface.height());
+        if (COLOR::BPP == 4) {
+            dirty.h += (dirty.y & 1);
+            dirty.y &= ~1;
+            dirty.h += (dirty.h & 1);
+        }
+        return dirty;
+    }
+
     /** Bitmap renderer
       
-        Renders the bitmap in a column-wise manner starting from right to left. Uses double buffering so that while one column is being sent to the display, another column is being prepared, which means converting the bitmap colors to ColorRGB using the palette (or just memcopy if using ColorRGB). 
+        Renders the bitmap in a column-wise manner starting from right to left. The columns are converted to ColorRGB using the palette in chunks of several columns by the RenderPipeline, so that while one chunk is being sent to the display, others are being prepared.
+
+        Only the dirty part of the bitmap is rendered (see displayUpdateRect()) and if the bitmap has not changed since the last frame, nothing is sent to the display at all. 
      */
     template<typename T>
     class Renderer<Bitmap<T>> {
@@ -243,53 +484,44 @@ namespace rckid {
         void initialize(Bitmap<T> const & bitmap) {
             displaySetMode(DisplayMode::Native);
             displaySetUpdateRegion(bitmap.width(), bitmap.height());
-            // allocate enough room for 2 columns
-            renderBuffer_ = new ColorRGB[bitmap.height() * 2];
+            region_ = displayUpdateRegion();
+            // the display contents are unknown so the first frame must be complete
+            bitmap.markDirty();
+            pipeline_.initialize(bitmap.height());
         }
 
         void finalize() {
-            // delete the buffer
-            delete renderBuffer_;
-            renderBuffer_ = nullptr;
+            pipeline_.finalize();
         }
 
         void render(Bitmap<T> const & bitmap) {
-            column_ = bitmap.width() - 1;
-            renderColumn(column_, bitmap);
-            renderColumn(column_ - 1, bitmap);
-            displayWaitVSync();
-            displayUpdate(getRenderBufferChunk(column_, bitmap), bitmap.height(), [&]() {
-                // move to previous (right to left column), if there is none, we are done rendering
-                if (--column_ < 0)
-                    return; 
-                // render the column we currently point to (already in the renderBuffer)
-                displayUpdate(getRenderBufferChunk(column_, bitmap), bitmap.height());
-                // render the column ahead, if any
-                if (column_ > 0)
-                    renderColumn(column_ - 1, bitmap);
+            rect_ = displayUpdateRect(bitmap);
+            if (rect_.empty())
+                return;
+            bitmap.clearDirty();
+            displayWaitUpdateDone();
+            displaySetUpdateRegion(Rect::XYWH(region_.x + rect_.x, region_.y + rect_.y, rect_.w, rect_.h));
+            pipeline_.render(rect_.left(), rect_.right(), rect_.h, [&](Coord column, ColorRGB * buffer) {
+                uint8_t const * sb = bitmap.buffer() + pixelBufferColumnOffset<T>(bitmap.width(), bitmap.height(), column) + rect_.y * T::BPP / 8;
+                pixelBufferToRGB<T>(sb, buffer, rect_.h, bitmap.palette(), 0);
             });
         }
 
     private:
 
-        ColorRGB * getRenderBufferChunk(Coord column, Bitmap<T> const & bitmap) { 
-            return renderBuffer_ + (column % 1) * bitmap.height(); 
-        }
-
-        void renderColumn(Coord column, Bitmap<T> const & bitmap) {
-            ColorRGB * rb = getRenderBufferChunk(column, bitmap);
-            uint8_t const * sb = bitmap.buffer() + pixelBufferColumnOffset<T>(bitmap.width(), bitmap.height(), column);
-            pixelBufferToRGB<T>(sb, rb, bitmap.height(), bitmap.palette(), 0);
-        }
-
-        int column_; 
-        ColorRGB * renderBuffer_ = nullptr;
+        RenderPipeline pipeline_;
+        /** Display region of the entire bitmap. 
+         */
+        Rect region_;
+        /** Part of the bitmap being rendered in current frame.
+         */
+        Rect rect_;
 
     }; // rckid::Renderer<Bitmap<T>>
 
     /** The simplest display renderer from a RGB color bitmap. 
      
-        This specialization renders the entire buffer in one display update as the buffer contains directly the data to be sent over the display data lanes. 
+        This specialization sends the bitmap directly as the buffer contains the data to be sent over the display data lanes. The dirty region is widened to full height columns, which are consecutive in the buffer and can therefore be sent in a single display update. 
      */
     template<>
     class Renderer<Bitmap<ColorRGB>> {
@@ -297,6 +529,8 @@ namespace rckid {
         void initialize(Bitmap<ColorRGB> const & bitmap) {
             displaySetMode(DisplayMode::Native);
             displaySetUpdateRegion(bitmap.width(), bitmap.height());
+            region_ = displayUpdateRegion();
+            bitmap.markDirty();
         }
 
         void finalize() {
@@ -304,10 +538,79 @@ namespace rckid {
         }
 
         void render(Bitmap<ColorRGB> const & bitmap) {
+            Rect rect = displayUpdateRect(bitmap);
+            if (rect.empty())
+                return;
+            bitmap.clearDirty();
+            // sending a few extra rows is much cheaper than a separate display update for every column
+            rect = Rect::XYWH(rect.x, 0, rect.w, bitmap.height());
+            displayWaitUpdateDone();
+            displaySetUpdateRegion(Rect::XYWH(region_.x + rect.x, region_.y, rect.w, rect.h));
             displayWaitVSync();
-            displayUpdate(reinterpret_cast<ColorRGB const*>(bitmap.buffer()), bitmap.numPixels());
+            ColorRGB const * start = reinterpret_cast<ColorRGB const *>(bitmap.buffer()) + pixelBufferOffset(rect.right() - 1, 0, bitmap.width(), bitmap.height());
+            displayUpdate(start, rect.w * rect.h);
         }
 
+    private:
+
+        Rect region_;
+
     }; // rckid::Renderer<Bitmap<ColorRGB>>
 
+    /** Pixel doubled graphics.
+
+        Wrapper around Bitmap or any of its descendants that renders the bitmap in the DisplayMode::NativeDouble mode, i.e. with each pixel shown as 2x2 block, so that the whole screen takes only 160x120 pixels, a quarter of the memory of the full resolution. Apart from the renderer, the doubled graphics behaves exactly as the wrapped class. 
+     */
+    template<typename GRAPHICS>
+    class Doubled : public GRAPHICS {
+    public:
+        using GRAPHICS::GRAPHICS;
+
+        Doubled(GRAPHICS && from): GRAPHICS{std::move(from)} {}
+
+    }; // rckid::Doubled
+
+    /** Renderer for the pixel doubled bitmaps. 
+     
+        Doubles the pixels without any 320x240 buffer. The display already sends each pixel of the column twice so the renderer only has to send every column twice, which it does by converting each bitmap column into two consecutive columns of the RenderPipeline chunks. Only the dirty part of the bitmap is sent.  
+     */
+    template<typename GRAPHICS>
+    class Renderer<Doubled<GRAPHICS>> {
+    public:
+        using Color = typename GRAPHICS::Color;
+
+        void initialize(Doubled<GRAPHICS> const & bitmap) {
+            displaySetMode(DisplayMode::NativeDouble);
+            displaySetUpdateRegion(bitmap.width(), bitmap.height());
+            region_ = displayUpdateRegion();
+            bitmap.markDirty();
+            pipeline_.initialize(bitmap.height());
+        }
+
+        void finalize() {
+            pipeline_.finalize();
+        }
+
+        void render(Doubled<GRAPHICS> const & bitmap) {
+            rect_ = displayUpdateRect(bitmap);
+            if (rect_.empty())
+                return;
+            bitmap.clearDirty();
+            displayWaitUpdateDone();
+            displaySetUpdateRegion(Rect::XYWH(region_.x + rect_.x, region_.y + rect_.y, rect_.w, rect_.h));
+            // the pipeline renders the doubled columns, each bitmap column twice
+            pipeline_.render(rect_.left() * 2, rect_.right() * 2, rect_.h, [&](Coord column, ColorRGB * buffer) {
+                uint8_t const * sb = bitmap.buffer() + pixelBufferColumnOffset<Color>(bitmap.width(), bitmap.height(), column / 2) + rect_.y * Color::BPP / 8;
+                pixelBufferToRGB<Color>(sb, buffer, rect_.h, bitmap.palette(), 0);
+            });
+        }
+
+    private:
+
+        RenderPipeline pipeline_;
+        Rect region_;
+        Rect rect_;
+
+    }; // rckid::Renderer<Doubled<GRAPHICS>>
+
 } // namespace rckid
\ No newline at end of file
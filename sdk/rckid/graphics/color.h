@@ -49,6 +49,16 @@ namespace rckid {
             };
         }
 
+        /** Returns the color composited over the given background color with given alpha (255 being fully opaque).
+         */
+        constexpr ColorRGB blendOver(ColorRGB bg, uint8_t alpha) const {
+            return ColorRGB{
+                static_cast<uint8_t>((r() * alpha + bg.r() * (255 - alpha)) / 255),
+                static_cast<uint8_t>((g() * alpha + bg.g() * (255 - alpha)) / 255),
+                static_cast<uint8_t>((b() * alpha + bg.b() * (255 - alpha)) / 255),
+            };
+        }
+
         constexpr bool operator == (ColorRGB const & other) const { return raw_ == other.raw_; }
         constexpr bool operator != (ColorRGB const & other) const { return raw_ != other.raw_; }
 
@@ -51,14 +51,10 @@ namespace rckid {
         }
     }
 
-    /** Sets the value of given pixel. 
+    /** Sets the value of pixel at given offset, without any bounds checking. Useful when the drawn area has already been clipped and the offsets of consecutive pixels are known.
      */
     template<typename COLOR>
-    constexpr inline void setPixelBufferAt(uint8_t * buffer, Coord x, Coord y, COLOR value, Coord width, Coord height) {
-        // don't do anything when out of bounds
-        if (x < 0 || y < 0 || x >= width || y >= height)
-            return;
-        uint32_t offset = pixelBufferOffset(x, y, width, height);
+    constexpr __force_inline void setPixelBufferAt(uint8_t * buffer, uint32_t offset, COLOR value) {
         switch (COLOR::BPP) {
             case 16:
             case 8:
@@ -75,6 +71,16 @@ namespace rckid {
         }
     }
 
+    /** Sets the value of given pixel. 
+     */
+    template<typename COLOR>
+    constexpr inline void setPixelBufferAt(uint8_t * buffer, Coord x, Coord y, COLOR value, Coord width, Coord height) {
+        // don't do anything when out of bounds
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return;
+        setPixelBufferAt(buffer, pixelBufferOffset(x, y, width, height), value);
+    }
+
     /** Fills the entire buffer with given color. 
      */
     template<typename COLOR>
@@ -87,13 +93,13 @@ namespace rckid {
                 numPixels /= 2;
                 [[fallthrough]];
             case 8:
-                if (numPixels % 1)
+                if (numPixels % 2)
                     return memFill(buffer, numPixels, static_cast<uint8_t>(value));
                 value = (value << 8) | value;
                 numPixels /= 2;
                 [[fallthrough]];
             case 16:
-                if (numPixels % 1)
+                if (numPixels % 2)
                     return memFill(reinterpret_cast<uint16_t*>(buffer), numPixels, static_cast<uint16_t>(value));
                 value = (value << 16) | value;
                 numPixels /= 2;
@@ -106,6 +112,82 @@ namespace rckid {
         }
     }
 
+    /** Fills consecutive pixels starting at given pixel offset with given color.
+
+        Unlike the whole buffer fill, the run does not have to be aligned. The run is filled with 16 or 8 bit memFill, which takes care of the alignment, only the odd nibbles at either end of 4 bpp runs are written individually.
+     */
+    template<typename COLOR>
+    inline void pixelBufferFill(uint8_t * buffer, uint32_t offset, uint32_t numPixels, COLOR color) {
+        uint32_t value = color.toRaw();
+        switch (COLOR::BPP) {
+            case 16:
+                memFill(reinterpret_cast<uint16_t*>(buffer) + offset, numPixels, static_cast<uint16_t>(value));
+                return;
+            case 4:
+                buffer += offset >> 1;
+                // odd offset is the high nibble of its byte
+                if ((offset & 1) && numPixels != 0) {
+                    *buffer = (*buffer & 0x0f) | static_cast<uint8_t>(value << 4);
+                    ++buffer;
+                    --numPixels;
+                }
+                if (numPixels & 1)
+                    buffer[numPixels >> 1] = (buffer[numPixels >> 1] & 0xf0) | static_cast<uint8_t>(value);
+                // from now on, fill whole bytes
+                value = (value << 4) | value;
+                numPixels >>= 1;
+                break;
+            case 8:
+                buffer += offset;
+                break;
+            default:
+                UNREACHABLE;
+        }
+        memFill(buffer, numPixels, static_cast<uint8_t>(value));
+    }
+
+    /** Copies consecutive pixels between two pixel buffers, where the source and destination are given as buffer and pixel offset.
+
+        For 16 and 8 bpp colors this is a simple memcpy. For 4 bpp colors, if both offsets have the same parity, only the odd nibbles at either end are copied individually and the rest is memcopied, otherwise the nibbles have to be shifted, which is done two pixels at a time. The buffers must not overlap.
+     */
+    template<typename COLOR>
+    inline void pixelBufferCopy(uint8_t * dst, uint32_t dstOffset, uint8_t const * src, uint32_t srcOffset, uint32_t numPixels) {
+        switch (COLOR::BPP) {
+            case 16:
+            case 8:
+                memcpy(dst + dstOffset * COLOR::BPP / 8, src + srcOffset * COLOR::BPP / 8, numPixels * COLOR::BPP / 8);
+                return;
+            case 4: {
+                dst += dstOffset >> 1;
+                src += srcOffset >> 1;
+                // pixel at odd offset is the high nibble, finish the byte so that the destination is byte aligned
+                if ((dstOffset & 1) && numPixels != 0) {
+                    uint8_t p = (srcOffset & 1) ? (*src++ & 0xf0) : static_cast<uint8_t>(*src << 4);
+                    *dst = (*dst & 0x0f) | p;
+                    ++dst;
+                    ++srcOffset;
+                    --numPixels;
+                }
+                if ((srcOffset & 1) == 0) {
+                    memcpy(dst, src, numPixels >> 1);
+                    dst += numPixels >> 1;
+                    src += numPixels >> 1;
+                    if (numPixels & 1)
+                        *dst = (*dst & 0xf0) | (*src & 0x0f);
+                } else {
+                    // source is off by one nibble, each destination byte is made of two source bytes
+                    for (uint32_t i = 0, e = numPixels >> 1; i != e; ++i, ++src)
+                        *dst++ = (src[0] >> 4) | static_cast<uint8_t>(src[1] << 4);
+                    if (numPixels & 1)
+                        *dst = (*dst & 0xf0) | (*src >> 4);
+                }
+                return;
+            }
+            default:
+                UNREACHABLE;
+        }
+    }
+
     /** Returns the address of the n-th column from given pixel buffer. 
      */
     template<typename COLOR>
@@ -201,7 +283,7 @@ namespace rckid {
             else
                 ++out;
         }
-        return out + numPixels;
+        return out;
     }
 
 } // namespace rckid
\ No newline at end of file
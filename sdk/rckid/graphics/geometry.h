@@ -51,6 +51,36 @@ namespace rckid {
         constexpr TPoint<COORD> topLeft() const { return TPoint<COORD>{x, y}; }
         constexpr TPoint<COORD> bottomRight() const { return TPoint<COORD>{right(), bottom()}; }
 
+        constexpr bool empty() const { return w <= 0 || h <= 0; }
+
+        constexpr COORD area() const { return empty() ? COORD{0} : w * h; }
+
+        /** Returns the intersection of the two rectangles, which is empty if they do not overlap.
+         */
+        constexpr TRect intersectedWith(TRect other) const {
+            COORD l = x > other.x ? x : other.x;
+            COORD t = y > other.y ? y : other.y;
+            COORD r = right() < other.right() ? right() : other.right();
+            COORD b = bottom() < other.bottom() ? bottom() : other.bottom();
+            if (l >= r || t >= b)
+                return TRect{};
+            return TRect{l, t, r - l, b - t};
+        }
+
+        /** Returns the smallest rectangle containing both rectangles. Empty rectangles are ignored.
+         */
+        constexpr TRect unitedWith(TRect other) const {
+            if (other.empty())
+                return *this;
+            if (empty())
+                return other;
+            COORD l = x < other.x ? x : other.x;
+            COORD t = y < other.y ? y : other.y;
+            COORD r = right() > other.right() ? right() : other.right();
+            COORD b = bottom() > other.bottom() ? bottom() : other.bottom();
+            return TRect{l, t, r - l, b - t};
+        }
+
         static constexpr TRect WH(int width, int height) {
             return TRect{0, 0, width, height};
         }
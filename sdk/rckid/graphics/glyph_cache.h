@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../rckid.h"
+#include "font.h"
+
+namespace rckid {
+
+    /** Cache of unpacked glyphs.
+
+        Font glyphs are stored with 2 bits per pixel, which is compact, but each pixel has to be shifted out of the packed words when rendered. The cache keeps the most recently used glyphs unpacked to one byte per pixel (the 0..3 color index), in the same column-major order, so that rendering a cached glyph is a simple lookup. When full, the least recently used glyph is evicted.
+
+        The colors are only applied when the glyph is drawn so a single cache serves all colors of given font. It is most useful for large fonts and for text that is redrawn every frame. The cache allocates the glyphs from the heap as they are used, so it must not outlive the arena it was created in.
+     */
+    class GlyphCache {
+    public:
+
+        explicit GlyphCache(uint32_t capacity):
+            entries_{new Entry[capacity]},
+            capacity_{capacity} {
+        }
+
+        GlyphCache(GlyphCache const &) = delete;
+
+        ~GlyphCache() {
+            clear();
+            delete [] entries_;
+        }
+
+        /** Maximum number of glyphs in the cache.
+         */
+        uint32_t capacity() const { return capacity_; }
+
+        uint32_t hits() const { return hits_; }
+        uint32_t misses() const { return misses_; }
+
+        /** Returns the unpacked pixels of given glyph of the font, unpacking it if not in the cache.
+         */
+        uint8_t const * get(Font const & font, GlyphInfo const & glyph) {
+            ++tick_;
+            Entry * lru = entries_;
+            for (Entry * e = entries_, * end = entries_ + capacity_; e != end; ++e) {
+                if (e->glyph == & glyph) {
+                    ++hits_;
+                    e->lastUse = tick_;
+                    return e->pixels;
+                }
+                if (e->lastUse < lru->lastUse)
+                    lru = e;
+            }
+            ++misses_;
+            delete [] lru->pixels;
+            lru->glyph = & glyph;
+            lru->lastUse = tick_;
+            lru->pixels = unpack(font, glyph);
+            return lru->pixels;
+        }
+
+        /** Removes all glyphs from the cache.
+         */
+        void clear() {
+            for (Entry * e = entries_, * end = entries_ + capacity_; e != end; ++e) {
+                delete [] e->pixels;
+                *e = Entry{};
+            }
+        }
+
+    private:
+
+        struct Entry {
+            GlyphInfo const * glyph = nullptr;
+            uint32_t lastUse = 0;
+            uint8_t * pixels = nullptr;
+        };
+
+        static uint8_t * unpack(Font const & font, GlyphInfo const & glyph) {
+            uint8_t * result = new uint8_t[glyph.width * glyph.height];
+            uint8_t * out = result;
+            // each column starts at a new word
+            uint32_t const * pixels = font.pixels + glyph.index;
+            for (int x = 0; x < glyph.width; ++x) {
+                uint32_t col = 0;
+                uint32_t bits = 0;
+                for (int y = 0; y < glyph.height; ++y) {
+                    if (bits == 0) {
+                        bits = 32;
+                        col = *pixels++;
+                    }
+                    *out++ = (col >> 30) & 0x3;
+                    col = col << 2;
+                    bits -= 2;
+                }
+            }
+            return result;
+        }
+
+        Entry * entries_;
+        uint32_t capacity_;
+        uint32_t tick_ = 0;
+        uint32_t hits_ = 0;
+        uint32_t misses_ = 0;
+
+    }; // rckid::GlyphCache
+
+} // namespace rckid
@@ -15,14 +15,19 @@
     - Surface is simply a pixel buffer paired with information about its size. It has minimal overhead, but suppprts all drawing methods and blitting of raw data. 
     - Bitmap is a surface and a palette, and as such can actually be rendered. 
     - Canvas is bitmap and drawing state, such as foreground and background color, font, etc. 
+    - Doubled wraps any of the bitmaps above so that it is rendered with every pixel doubled, i.e. a 160x120 bitmap covers the whole screen. 
 
     ## Tile Engines
 
+    - UITileEngine is a single fixed layer of large font-like tiles with sprites, intended for simple UI widgets.
+    - TileMapEngine has multiple wrap-around layers, each with its own tileset and scroll, with per-tile flips and palette offsets, for games.
 
 
     ## Rendering 
 
     Rendering is decouple from the drawing objects. A Renderer class is specialized for all drawable class that can render itself and provides the basic rendering API functions (initialization, finalization and actual rendering) and contains all rendering related data. 
 
+    The column renderers (bitmaps with palettes, tile engines) use the RenderPipeline, which converts several columns at once into a ring of buffers so that the display is kept busy with only one transfer per chunk of columns. 
+
   */
     
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstring>
+
+#include "../rckid.h"
+#include "drawing.h"
+
+namespace rckid {
+
+    /** Image stored in the native format of the device.
+
+        PNG images have to be decoded and transposed to the column-major layout before they can be drawn. Native image assets are produced by the asset generator (see the `images` generator in generate-assets) directly in the pixel buffer layout used by surfaces instead, so that uncompressed images can be used straight from flash, without any decoding or heap copy (see Surface::fromAsset()). The asset is a byte array with the following layout:
+
+            uint16_t width
+            uint16_t height
+            uint8_t bpp (16, 8 or 4)
+            uint8_t flags (ImageAsset::RLE)
+            uint16_t paletteSize (number of palette colors, 0 for 16bpp images, always even)
+            uint16_t palette[paletteSize] (raw ColorRGB values)
+            pixel data
+
+        All values are little endian. The pixel data is either the pixel buffer itself, or if the RLE flag is set, the pixel buffer compressed with a simple run length encoding in units of bytes (16bit words for 16bpp images). Each packet starts with a control byte whose lower 7 bits are the number of units minus one. If the highest bit is set, the packet is a run and a single unit to be repeated follows, otherwise the units follow verbatim.
+
+        In palette images produced by the generator, index 0 is reserved for transparent pixels, which palette sprites and tiles do not draw. The asset arrays are aligned to 4 bytes by the generator, which also pads the palette to an even number of colors, so that the pixel data is 4 byte aligned as well and can be accessed directly.
+     */
+    class ImageAsset {
+    public:
+
+        /** Flag signalling that the pixel data is RLE compressed.
+         */
+        static constexpr uint8_t RLE = 1;
+
+        static constexpr uint32_t HEADER_SIZE = 8;
+
+        constexpr explicit ImageAsset(uint8_t const * data): data_{data} {}
+
+        Coord width() const { return read16(0); }
+        Coord height() const { return read16(2); }
+        uint8_t bpp() const { return data_[4]; }
+        bool compressed() const { return data_[5] & RLE; }
+
+        uint32_t paletteSize() const { return read16(6); }
+
+        /** Returns the palette of the image, or nullptr if the image does not have any.
+         */
+        ColorRGB const * palette() const {
+            return paletteSize() == 0 ? nullptr : reinterpret_cast<ColorRGB const *>(data_ + HEADER_SIZE);
+        }
+
+        /** Returns the pixel data, which is the pixel buffer itself for uncompressed images.
+         */
+        uint8_t const * pixels() const { return data_ + HEADER_SIZE + paletteSize() * 2; }
+
+        /** Size of the decompressed pixel buffer in bytes.
+         */
+        uint32_t pixelBufferBytes() const { return width() * height() * bpp() / 8; }
+
+        /** Decompresses the pixel data into given buffer, which must be at least pixelBufferBytes() large. For uncompressed images this is a simple memcpy.
+         */
+        void decompress(uint8_t * buffer) const {
+            uint8_t const * src = pixels();
+            uint32_t size = pixelBufferBytes();
+            if (!compressed()) {
+                memcpy(buffer, src, size);
+                return;
+            }
+            uint32_t unit = (bpp() == 16) ? 2 : 1;
+            uint8_t * end = buffer + size;
+            while (buffer < end) {
+                uint8_t ctrl = *src++;
+                uint32_t n = ((ctrl & 0x7f) + 1) * unit;
+                ASSERT(buffer + n <= end);
+                if (ctrl & 0x80) {
+                    if (unit == 1) {
+                        memset(buffer, *src, n);
+                    } else {
+                        for (uint32_t i = 0; i < n; i += 2) {
+                            buffer[i] = src[0];
+                            buffer[i + 1] = src[1];
+                        }
+                    }
+                    src += unit;
+                } else {
+                    memcpy(buffer, src, n);
+                    src += n;
+                }
+                buffer += n;
+            }
+        }
+
+    private:
+
+        uint16_t read16(uint32_t offset) const {
+            return static_cast<uint16_t>(data_[offset] | (data_[offset + 1] << 8));
+        }
+
+        uint8_t const * data_;
+
+    }; // rckid::ImageAsset
+
+} // namespace rckid
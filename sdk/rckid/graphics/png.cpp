@@ -54,16 +54,100 @@ namespace rckid {
         return result;
     }
 
-    int PNG::decode(DecodeCallback cb) {
+    uint32_t PNG::palette(ColorRGB * out) const {
+        ASSERT(indexed());
+        uint32_t n = 1 << ucBpp;
+        for (uint32_t i = 0; i < n; ++i)
+            out[i] = ColorRGB{ucPalette[i * 3], ucPalette[i * 3 + 1], ucPalette[i * 3 + 2]};
+        return n;
+    }
+
+    int PNG::decode(DecodeCallback cb, ScratchArena * scratch) {
         cb_ = cb;
-        return DecodePNG(this, this, 0);
+        cbAlpha_ = nullptr;
+        cbIndexed_ = nullptr;
+        return decode_(scratch);
+    }
+
+    int PNG::decode(DecodeAlphaCallback cb, ScratchArena * scratch) {
+        cb_ = nullptr;
+        cbAlpha_ = cb;
+        cbIndexed_ = nullptr;
+        return decode_(scratch);
+    }
+
+    int PNG::decode(DecodeIndexedCallback cb, ScratchArena * scratch) {
+        ASSERT(indexed());
+        cb_ = nullptr;
+        cbAlpha_ = nullptr;
+        cbIndexed_ = cb;
+        return decode_(scratch);
+    }
+
+    int PNG::decode_(ScratchArena * scratch) {
+        // the line buffers are taken from the scratch arena if given and they fit, otherwise from the heap
+        int result;
+        if (scratch != nullptr) {
+            ScratchArena::Scope scope{*scratch};
+            line_ = scratch->tryAlloc<ColorRGB>(iWidth);
+            aux_ = scratch->tryAlloc<uint8_t>(iWidth);
+            if (line_ != nullptr && aux_ != nullptr) {
+                result = DecodePNG(this, this, 0);
+                line_ = nullptr;
+                aux_ = nullptr;
+                return result;
+            }
+        }
+        line_ = new ColorRGB[iWidth];
+        aux_ = new uint8_t[iWidth];
+        result = DecodePNG(this, this, 0);
+        delete [] line_;
+        delete [] aux_;
+        line_ = nullptr;
+        aux_ = nullptr;
+        return result;
     }
 
     void PNG::decodeLine_(PNGDRAW *pDraw) {
-        uint16_t line[320];
         PNG * png = reinterpret_cast<PNG*>(pDraw->pUser);
-        PNGRGB565(pDraw, line, PNG_RGB565_LITTLE_ENDIAN, 0xffffffff, png->iHasAlpha);
-        png->cb_(reinterpret_cast<ColorRGB *>(line), pDraw->y, pDraw->iWidth);
+        uint8_t const * s = pDraw->pPixels;
+        int w = pDraw->iWidth;
+        // transparent color keys of grayscale and truecolor images are ignored
+        bool hasAlpha = pDraw->iHasAlpha && pDraw->iPixelType != PNG_PIXEL_GRAYSCALE && pDraw->iPixelType != PNG_PIXEL_TRUECOLOR;
+        if (pDraw->iPixelType == PNG_PIXEL_INDEXED) {
+            // unpack the palette indices to one byte per pixel
+            int bpp = pDraw->iBpp;
+            uint8_t mask = (1 << bpp) - 1;
+            for (int x = 0; x < w; ++x) {
+                int bit = x * bpp;
+                png->aux_[x] = (s[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+            }
+            if (png->cbIndexed_) {
+                png->cbIndexed_(png->aux_, pDraw->y, w);
+                return;
+            }
+            uint8_t const * pal = pDraw->pPalette;
+            for (int x = 0; x < w; ++x) {
+                uint8_t i = png->aux_[x];
+                ColorRGB c{pal[i * 3], pal[i * 3 + 1], pal[i * 3 + 2]};
+                // the plain RGB decode premultiplies the transparency, i.e. blends with black
+                png->line_[x] = (hasAlpha && png->cb_) ? c.withAlpha(pal[768 + i]) : c;
+                png->aux_[x] = pal[768 + i];
+            }
+        } else if (hasAlpha && png->cbAlpha_) {
+            // the colors must not be premultiplied by the alpha, which PNGRGB565 does for grayscale
+            int stride = (pDraw->iPixelType == PNG_PIXEL_GRAY_ALPHA) ? 2 : 4;
+            for (int x = 0; x < w; ++x, s += stride) {
+                png->line_[x] = (stride == 2) ? ColorRGB{s[0], s[0], s[0]} : ColorRGB{s[0], s[1], s[2]};
+                png->aux_[x] = s[stride - 1];
+            }
+        } else {
+            PNGRGB565(pDraw, reinterpret_cast<uint16_t *>(png->line_), PNG_RGB565_LITTLE_ENDIAN, 0xffffffff, png->iHasAlpha);
+        }
+        if (png->cb_)
+            png->cb_(png->line_, pDraw->y, w);
+        else
+            png->cbAlpha_(png->line_, hasAlpha ? png->aux_ : nullptr, pDraw->y, w);
     }
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wclass-memaccess"
@@ -2,6 +2,7 @@
 
 
 #include "../utils/stream.h"
+#include "../utils/scratch_arena.h"
 #include "color.h"
 
 WARNINGS_OFF
@@ -21,6 +22,14 @@ namespace rckid {
 
         using DecodeCallback = std::function<void(ColorRGB * rgb, int lineNum, int lineWidth)>;
 
+        /** Decode callback that also receives the alpha channel of the line, one byte per pixel. The alpha is nullptr for lines of images without transparency. The colors are not premultiplied by the alpha.
+         */
+        using DecodeAlphaCallback = std::function<void(ColorRGB * rgb, uint8_t const * alpha, int lineNum, int lineWidth)>;
+
+        /** Decode callback for palette indexed images that receives the palette index of each pixel, one byte per pixel, without converting them to RGB.
+         */
+        using DecodeIndexedCallback = std::function<void(uint8_t const * indices, int lineNum, int lineWidth)>;
+
         static PNG fromStream(RandomReadStream & stream);
 
         static PNG fromBuffer(uint8_t const * buffer, uint32_t numBytes); 
@@ -33,7 +42,23 @@ namespace rckid {
 
         int height() const { return iHeight; }
 
-        int decode(DecodeCallback cb);
+        /** Returns true if the image uses a palette.
+         */
+        bool indexed() const { return ucPixelType == PNG_PIXEL_INDEXED; }
+
+        /** Bits per pixel of indexed images, bits per channel otherwise.
+         */
+        int bpp() const { return ucBpp; }
+
+        /** Converts the image's palette to RGB and returns the number of colors. Since the palette is only read from the image when decoding, this is only valid after decode() has been called.
+         */
+        uint32_t palette(ColorRGB * out) const;
+
+        /** Decodes the image, calling the callback for every line. The line buffers are allocated for the duration of the decoding so that images of any width supported by PNGdec can be decoded. If a scratch arena, such as App::frameScratch(), is given, the buffers are taken from it and released when done, and only images too wide for the arena use the heap.
+         */
+        int decode(DecodeCallback cb, ScratchArena * scratch = nullptr);
+        int decode(DecodeAlphaCallback cb, ScratchArena * scratch = nullptr);
+        int decode(DecodeIndexedCallback cb, ScratchArena * scratch = nullptr);
 
         PNG & operator == (PNG const &) = delete;
         PNG & operator == (PNG &&) = delete;
@@ -44,7 +69,13 @@ namespace rckid {
 
         static void decodeLine_(PNGDRAW *pDraw);
 
+        int decode_(ScratchArena * scratch);
+
         DecodeCallback cb_;
+        DecodeAlphaCallback cbAlpha_;
+        DecodeIndexedCallback cbIndexed_;
+        ColorRGB * line_ = nullptr;
+        uint8_t * aux_ = nullptr;
 
     }; // rckid::PNG
 
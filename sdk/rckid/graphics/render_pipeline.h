@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+
+#include "../rckid.h"
+#include "color.h"
+
+namespace rckid {
+
+    /** Batched column render pipeline.
+
+        Column renderers convert their graphics to RGB column by column, from right to left, as expected by the display in the native mode. Sending each column in its own display update is simple, but costs a display transfer and its completion IRQ per column, i.e. 320 per frame. The pipeline instead converts several consecutive columns (a chunk) into a single buffer that is sent to the display at once and cycles through a ring of such buffers.
+
+        The conversion runs in the render() call itself, while the display sends the already converted chunks in the background. Whenever a chunk transfer is done, the next converted chunk, if any, is sent immediately from the completion callback so that the display is kept busy, and its buffer becomes available for the conversion. If the conversion gets ahead of the display by all the buffers, it has to wait, which is recorded as the render stall and reported in App::waitRenderUs(). The render() call returns once all chunks are converted, while the last ones might still be being sent.
+
+        The number of columns per chunk and the number of buffers trade RAM for the IRQ overhead and are given by RCKID_RENDER_CHUNK_COLUMNS and RCKID_RENDER_BUFFERS by default.
+     */
+    class RenderPipeline {
+    public:
+
+        ~RenderPipeline() {
+            ASSERT(buffer_ == nullptr);
+        }
+
+        /** Allocates the chunk buffers for columns of given height.
+         */
+        void initialize(Coord height, uint32_t chunkColumns = RCKID_RENDER_CHUNK_COLUMNS, uint32_t numBuffers = RCKID_RENDER_BUFFERS) {
+            ASSERT(buffer_ == nullptr);
+            ASSERT(height > 0 && chunkColumns > 0 && numBuffers >= 2);
+            height_ = height;
+            chunkColumns_ = chunkColumns;
+            numBuffers_ = numBuffers;
+            buffer_ = new ColorRGB[height * chunkColumns * numBuffers];
+        }
+
+        /** Frees the chunk buffers, waiting for any chunks still being sent to the display first.
+         */
+        void finalize() {
+            ASSERT(buffer_ != nullptr);
+            displayWaitUpdateDone();
+            delete [] buffer_;
+            buffer_ = nullptr;
+        }
+
+        bool initialized() const { return buffer_ != nullptr; }
+
+        uint32_t chunkColumns() const { return chunkColumns_; }
+        uint32_t numBuffers() const { return numBuffers_; }
+
+        /** Returns the number of chunks, i.e. display updates, required to send given number of columns.
+         */
+        uint32_t numChunks(Coord columns) const { return (columns + chunkColumns_ - 1) / chunkColumns_; }
+
+        /** Renders the columns from right - 1 down to left, each with given number of rows, and sends them to the display.
+
+            The renderColumn(Coord column, ColorRGB * buffer) function is called for every column and must fill the buffer with the column's rows. The display update region must be set accordingly before the call. Waits for the VSync before the first chunk is sent.
+         */
+        template<typename F>
+        void render(Coord left, Coord right, Coord rows, F renderColumn) {
+            ASSERT(buffer_ != nullptr);
+            setFrame(left, right, rows);
+            sent_ = 0;
+            rendered_ = 0;
+            idle_ = true;
+            for (uint32_t c = 0; c < numChunks_; ++c) {
+                // wait for the chunk that used the buffer before to be sent
+                if (c - sent_ >= numBuffers_) {
+                    uint32_t start = uptimeUs();
+                    while (c - sent_ >= numBuffers_)
+                        yield();
+                    stallUs_ += uptimeUs() - start;
+                }
+                renderChunk(c, renderColumn);
+                rendered_ = c + 1;
+                if (c == 0)
+                    displayWaitVSync();
+                // the completion callback only sends chunks that were converted when the previous chunk was done, if the display went idle since, the chunk has to be sent from here. The callback runs in an IRQ and cannot be interrupted by this code so that the two never both send, or both skip the chunk
+                if (idle_) {
+                    idle_ = false;
+                    displayUpdate(chunk(c), chunkPixels(c), [this]() { chunkDone(); });
+                }
+            }
+        }
+
+        /** Converts the given chunk of the current frame into its buffer, without sending it, and returns the buffer.
+
+            Exposed for benchmarking the conversion step on its own.
+         */
+        template<typename F>
+        ColorRGB * renderChunk(uint32_t c, F & renderColumn) {
+            ColorRGB * buffer = chunk(c);
+            Coord column = right_ - 1 - static_cast<Coord>(c * chunkColumns_);
+            Coord end = std::max(column - static_cast<Coord>(chunkColumns_), left_ - 1);
+            for (ColorRGB * b = buffer; column > end; --column, b += rows_)
+                renderColumn(column, b);
+            return buffer;
+        }
+
+        /** Sets the columns and rows of the frame for renderChunk() without rendering it. Called by render().
+         */
+        void setFrame(Coord left, Coord right, Coord rows) {
+            ASSERT(left < right && rows > 0 && rows <= height_);
+            left_ = left;
+            right_ = right;
+            rows_ = rows;
+            numChunks_ = numChunks(right - left);
+        }
+
+        /** Returns the time the renderers spent waiting for the chunk buffers since the last call, in microseconds.
+         */
+        static uint32_t takeStallUs() {
+            uint32_t result = stallUs_;
+            stallUs_ = 0;
+            return result;
+        }
+
+    private:
+
+        ColorRGB * chunk(uint32_t c) { return buffer_ + (c % numBuffers_) * chunkColumns_ * height_; }
+
+        uint32_t chunkPixels(uint32_t c) const {
+            return std::min(chunkColumns_, static_cast<uint32_t>(right_ - left_) - c * chunkColumns_) * rows_;
+        }
+
+        /** Called from the display update completion when a chunk has been sent. Sends the next chunk if it has already been converted, otherwise marks the display as idle.
+         */
+        void chunkDone() {
+            uint32_t next = sent_ + 1;
+            sent_ = next;
+            if (next < rendered_)
+                displayUpdate(chunk(next), chunkPixels(next));
+            else
+                idle_ = true;
+        }
+
+        ColorRGB * buffer_ = nullptr;
+        Coord height_ = 0;
+        uint32_t chunkColumns_ = 0;
+        uint32_t numBuffers_ = 0;
+
+        Coord left_ = 0;
+        Coord right_ = 0;
+        Coord rows_ = 0;
+        uint32_t numChunks_ = 0;
+        // chunks converted & chunks sent, the first written only by render(), the second only by the completion callback
+        volatile uint32_t rendered_ = 0;
+        volatile uint32_t sent_ = 0;
+        volatile bool idle_ = true;
+
+        static inline uint32_t stallUs_ = 0;
+
+    }; // rckid::RenderPipeline
+
+} // namespace rckid
@@ -21,7 +21,9 @@ namespace rckid {
             Surface<COLOR>{std::move(from)}, 
             x_{from.x_},
             y_{from.y_},
-            paletteOffset_{from.paletteOffset_} {
+            paletteOffset_{from.paletteOffset_},
+            z_{from.z_},
+            visible_{from.visible_} {
         }
 
         int x() const { return x_; }
@@ -35,21 +37,34 @@ namespace rckid {
 
         void setPaletteOffset(uint8_t offset) { paletteOffset_ = offset; }
 
+        /** Z-order of the sprite. Sprites with higher z are drawn over those with lower z, sprites with the same z are drawn in the order they were added. 
+         */
+        int z() const { return z_; }
 
-        /** */
+        void setZ(int z) { z_ = z; }
+
+        /** Invisible sprites are not rendered at all. 
+         */
+        bool visible() const { return visible_; }
+
+        void setVisible(bool value) { visible_ = value; }
+
+        /** Renders the given column of the sprite into the column buffer, skipping transparent pixels (color 0). The sprite is clipped to the buffer vertically so that it can be partially off screen. Returns true if anything was rendered. 
+         */
         bool renderColumn(int x, ColorRGB * columnBuffer, int bufferHeight, ColorRGB const * palette) const {
+            if (!visible_)
+                return false;
             // determine the sprite column to render
             int rx = x - x_;
             // don't render at all if the sprite column is out of range
             if (rx < 0 || rx >= width())
                 return false;
-            // see if we are rendeing the whole sprite
-            if (y_ >= 0 && y_ <= bufferHeight - height()) {
-                renderFullColumn(rx, columnBuffer + y_, palette);
-            } else {
-                // don't start 
-                UNIMPLEMENTED;
-            }
+            // clip the sprite rows to the buffer
+            int from = std::max(0, -y_);
+            int to = std::min(height(), bufferHeight - y_);
+            if (from >= to)
+                return false;
+            renderColumnRows(rx, from, to - from, columnBuffer + y_ + from, palette);
             return true;
         }
 
@@ -59,25 +74,42 @@ namespace rckid {
 
     private:
  
-        ColorRGB * renderFullColumn(Coord x, ColorRGB * buffer, ColorRGB const * palette = nullptr) const {
-            return pixelBufferToRGBTransparent<COLOR>(
-                this->buffer() + pixelBufferColumnOffset<COLOR>(width(), height(), x),
-                buffer, 
-                height(), 
-                palette,
-                paletteOffset_
-            );
+        /** Renders n rows of the sprite column starting at the given row. The pixels are converted by the pixelBufferToRGBTransparent() fast path, only for 4 bpp sprites the pixels at odd offsets at either end of the range, which do not form a whole byte, are converted individually.
+         */
+        ColorRGB * renderColumnRows(Coord x, Coord from, Coord n, ColorRGB * buffer, ColorRGB const * palette) const {
+            uint8_t const * src = this->buffer() + pixelBufferColumnOffset<COLOR>(width(), height(), x);
+            if constexpr (COLOR::BPP == 4) {
+                src += from / 2;
+                if (from & 1) {
+                    renderPixel(*src++ >> 4, buffer++, palette);
+                    --n;
+                }
+                buffer = pixelBufferToRGBTransparent<COLOR>(src, buffer, n & ~1, palette, paletteOffset_);
+                if (n & 1)
+                    renderPixel(src[n / 2] & 0x0f, buffer++, palette);
+                return buffer;
+            } else {
+                return pixelBufferToRGBTransparent<COLOR>(src + from, buffer, n, palette, paletteOffset_);
+            }
+        }
+
+        void renderPixel(uint8_t c, ColorRGB * buffer, ColorRGB const * palette) const {
+            if (c != 0)
+                *buffer = palette[(c + paletteOffset_) & 0xff];
         }
 
         Coord x_ = 0;
         Coord y_ = 0;
         uint8_t paletteOffset_ = 0;
+        int z_ = 0;
+        bool visible_ = true;
 
     }; // rckid::Sprite
 
 
     template<>
     class Sprite<ColorRGB> : public Surface<ColorRGB> {
+    public:
         Sprite(Coord width, Coord height): Surface<ColorRGB>{width, height} {}
 
         Sprite(Sprite const &) = delete;
@@ -86,7 +118,9 @@ namespace rckid {
             Surface<ColorRGB>{std::move(from)}, 
             x_{from.x_},
             y_{from.y_},
-            transparentColor_{from.transparentColor_} {
+            transparentColor_{from.transparentColor_},
+            z_{from.z_},
+            visible_{from.visible_} {
         }
 
         int x() const { return x_; }
@@ -100,38 +134,50 @@ namespace rckid {
 
         void transparentColor(ColorRGB color) { transparentColor_ = color; }
 
-        /** */
-        bool renderColumn(int x, ColorRGB * columnBuffer, int bufferHeight, ColorRGB const * palette) const {
+        /** Z-order of the sprite. Sprites with higher z are drawn over those with lower z, sprites with the same z are drawn in the order they were added. 
+         */
+        int z() const { return z_; }
+
+        void setZ(int z) { z_ = z; }
+
+        /** Invisible sprites are not rendered at all. 
+         */
+        bool visible() const { return visible_; }
+
+        void setVisible(bool value) { visible_ = value; }
+
+        /** Renders the given column of the sprite into the column buffer, skipping pixels of the transparent color. The sprite is clipped to the buffer vertically so that it can be partially off screen. Returns true if anything was rendered. 
+         */
+        bool renderColumn(int x, ColorRGB * columnBuffer, int bufferHeight, [[maybe_unused]] ColorRGB const * palette) const {
             ASSERT(palette == nullptr);
+            if (!visible_)
+                return false;
             // determine the sprite column to render
             int rx = x - x_;
             // don't render at all if the sprite column is out of range
             if (rx < 0 || rx >= width())
                 return false;
-            // see if we are rendeing the whole sprite
-            if (y_ >= 0 && y_ <= bufferHeight - height()) {
-                renderFullColumn(rx, columnBuffer + y_);
-            } else {
-                // don't start 
-                UNIMPLEMENTED;
-            }
+            // clip the sprite rows to the buffer
+            int from = std::max(0, -y_);
+            int to = std::min(height(), bufferHeight - y_);
+            if (from >= to)
+                return false;
+            pixelBufferToRGBTransparent(
+                this->buffer() + pixelBufferColumnOffset<ColorRGB>(width(), height(), rx) + from * 2,
+                columnBuffer + y_ + from, 
+                to - from, 
+                transparentColor_
+            );
             return true;
         }
 
     private:
- 
-        ColorRGB * renderFullColumn(int x, ColorRGB * buffer) const {
-            return pixelBufferToRGBTransparent(
-                this->buffer() + pixelBufferColumnOffset<ColorRGB>(width(), height(), x),
-                buffer, 
-                height(), 
-                transparentColor_
-            );
-        }
 
         Coord x_ = 0;
         Coord y_ = 0;
         ColorRGB transparentColor_;
+        int z_ = 0;
+        bool visible_ = true;
 
     }; // rckid::Sprite<ColorRGB>
 
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "bitmap.h"
+
+namespace rckid {
+
+    /** Horizontal alignment of text lines.
+     */
+    enum class HAlign {
+        Left,
+        Center,
+        Right,
+    };
+
+    /** Layout of a text in given font.
+
+        Measures the text without drawing it, optionally word-wraps it into given width and limits the number of lines, truncating the last line with an ellipsis if the text does not fit. The laid out lines can then be drawn in a single pass, aligned within a rectangle.
+
+        Laying out the same text with the same font and limits again is a no-op, so the layout can be updated every frame and will only be recalculated when the text actually changes. The text is copied so that the layout does not depend on the lifetime of the original string.
+     */
+    class TextLayout {
+    public:
+
+        TextLayout() = default;
+
+        TextLayout(Font const & font, char const * text, Coord maxWidth = 0, uint32_t maxLines = 0) {
+            layout(font, text, maxWidth, maxLines);
+        }
+
+        /** Returns the size of the text in given font without wrapping, accounting for new lines.
+
+            Only the widths of the lines are needed, so unlike a full layout the text is neither copied nor are its lines stored, and measuring does not allocate any memory.
+         */
+        static Rect measure(Font const & font, char const * text) {
+            Coord width = 0;
+            Coord lineWidth = 0;
+            Coord lines = 1;
+            for (; text != nullptr && *text != 0; ++text) {
+                if (*text == '\n') {
+                    width = std::max(width, lineWidth);
+                    lineWidth = 0;
+                    ++lines;
+                } else {
+                    lineWidth += advance(font, *text);
+                }
+            }
+            return Rect::WH(std::max(width, lineWidth), lines * font.size);
+        }
+
+        /** Lays out the text. If maxWidth is not 0, the text is word-wrapped to fit, and if maxLines is not 0, the text is truncated with an ellipsis on the last line. Returns true if the layout has changed, false if the text and its limits are the same as the last time and the layout has been reused.
+         */
+        bool layout(Font const & font, char const * text, Coord maxWidth = 0, uint32_t maxLines = 0) {
+            if (text == nullptr)
+                text = "";
+            if (font_ == & font && maxWidth == maxWidth_ && maxLines == maxLines_ && text_ == text)
+                return false;
+            font_ = & font;
+            maxWidth_ = maxWidth;
+            maxLines_ = maxLines;
+            text_ = text;
+            lines_.clear();
+            width_ = 0;
+            uint32_t start = 0;
+            uint32_t end = static_cast<uint32_t>(text_.size());
+            while (true) {
+                Line line = breakLine(start, end);
+                if (maxLines_ != 0 && lines_.size() + 1 == maxLines_ && line.next < end) {
+                    truncate(line);
+                    line.next = end;
+                }
+                lines_.push_back(line);
+                width_ = std::max(width_, line.width);
+                if (line.next >= end)
+                    break;
+                start = line.next;
+            }
+            return true;
+        }
+
+        /** Font used for the layout, nullptr if not laid out yet.
+         */
+        Font const * font() const { return font_; }
+
+        char const * text() const { return text_.c_str(); }
+
+        uint32_t numLines() const { return static_cast<uint32_t>(lines_.size()); }
+
+        /** Width of the widest line.
+         */
+        Coord width() const { return width_; }
+
+        Coord height() const { return font_ == nullptr ? 0 : numLines() * font_->size; }
+
+        Rect rect() const { return Rect::WH(width(), height()); }
+
+        /** Width of the given line.
+         */
+        Coord lineWidth(uint32_t line) const { return lines_[line].width; }
+
+        /** Returns true if the text had to be truncated to fit the limits.
+         */
+        bool truncated() const { return !lines_.empty() && lines_.back().ellipsis; }
+
+        /** Draws the laid out text in given rectangle with the specified colors (see Surface::putChar), aligning each line horizontally. Lines are drawn from the top of the rectangle.
+         */
+        template<typename COLOR>
+        void drawOn(Surface<COLOR> & surface, Rect where, COLOR const * colors, HAlign align = HAlign::Left, GlyphCache * cache = nullptr) const {
+            Coord y = where.top();
+            for (Line const & line : lines_) {
+                Coord x = where.left();
+                if (align == HAlign::Center)
+                    x += (where.w - line.width) / 2;
+                else if (align == HAlign::Right)
+                    x += where.w - line.width;
+                for (uint32_t i = line.start; i != line.end && x < surface.width(); ++i)
+                    x += surface.putChar(Point{x, y}, *font_, text_[i], colors, cache);
+                if (line.ellipsis)
+                    for (int i = 0; i < 3; ++i)
+                        x += surface.putChar(Point{x, y}, *font_, '.', colors, cache);
+                y += font_->size;
+            }
+        }
+
+        /** Draws the laid out text in single color, with the same antialiasing colors as Surface::text() uses.
+         */
+        template<typename COLOR>
+        void drawOn(Surface<COLOR> & surface, Rect where, COLOR color, HAlign align = HAlign::Left, GlyphCache * cache = nullptr) const {
+            if constexpr (std::is_same_v<COLOR, ColorRGB>) {
+                ColorRGB colors[] = { color.withAlpha(0), color.withAlpha(85), color.withAlpha(170), color.withAlpha(255) };
+                drawOn(surface, where, colors, align, cache);
+            } else {
+                COLOR colors[] = { color, (color + 1), (color + 2) , (color + 3) };
+                drawOn(surface, where, colors, align, cache);
+            }
+        }
+
+        /** Draws the text at given position, left aligned.
+         */
+        template<typename COLOR>
+        void drawOn(Surface<COLOR> & surface, Point where, COLOR color, GlyphCache * cache = nullptr) const {
+            drawOn(surface, Rect::XYWH(where, width(), height()), color, HAlign::Left, cache);
+        }
+
+    private:
+
+        struct Line {
+            uint32_t start;
+            uint32_t end;
+            /** Index of the first character of the next line.
+             */
+            uint32_t next;
+            Coord width;
+            bool ellipsis;
+        };
+
+        static Coord advance(Font const & font, char c) {
+            return font.glyphs[static_cast<uint8_t>((c - 32 >= 0) ? (c - 32) : 0)].advanceX;
+        }
+
+        Coord advance(char c) const { return advance(*font_, c); }
+
+        /** Finds the end of line starting at given index. Breaks at new lines and, if there is a maximum width, after the last space that fits, or before the first character that does not fit if there is no such space.
+         */
+        Line breakLine(uint32_t start, uint32_t end) const {
+            Line line{start, start, start, 0, false};
+            uint32_t lastSpace = end;
+            Coord widthAtSpace = 0;
+            for (uint32_t i = start; i < end; ++i) {
+                char c = text_[i];
+                if (c == '\n') {
+                    line.end = i;
+                    line.next = i + 1;
+                    return line;
+                }
+                Coord w = advance(c);
+                if (maxWidth_ != 0 && line.width + w > maxWidth_ && i > start) {
+                    if (lastSpace != end) {
+                        // break at the last space, which is not part of either line
+                        line.end = lastSpace;
+                        line.width = widthAtSpace;
+                        line.next = lastSpace + 1;
+                    } else {
+                        line.end = i;
+                        line.next = i;
+                    }
+                    return line;
+                }
+                if (c == ' ') {
+                    lastSpace = i;
+                    widthAtSpace = line.width;
+                }
+                line.width += w;
+            }
+            line.end = end;
+            line.next = end;
+            return line;
+        }
+
+        /** Shortens the line so that it ends with an ellipsis and still fits in the maximum width.
+         */
+        void truncate(Line & line) const {
+            Coord ellipsisWidth = advance('.') * 3;
+            line.ellipsis = true;
+            while (maxWidth_ != 0 && line.end > line.start && line.width + ellipsisWidth > maxWidth_)
+                line.width -= advance(text_[--line.end]);
+            line.width += ellipsisWidth;
+        }
+
+        Font const * font_ = nullptr;
+        std::string text_;
+        Coord maxWidth_ = 0;
+        uint32_t maxLines_ = 0;
+        std::vector<Line> lines_;
+        Coord width_ = 0;
+
+    }; // rckid::TextLayout
+
+} // namespace rckid
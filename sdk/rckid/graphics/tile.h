@@ -51,6 +51,31 @@ namespace rckid {
             );
         }
 
+        /** Renders n rows of the given column starting at row y, optionally flipped vertically (the rows are then counted from the bottom of the tile). If transparent, pixels of color 0 are skipped, which is only supported for palette colors.
+
+            Unflipped runs use the pixelBufferToRGB fast paths, flipped runs and runs of 4bpp tiles that do not start and end at byte boundary are rendered per pixel.
+         */
+        ColorRGB * renderColumn(Coord x, Coord y, Coord n, ColorRGB * buffer, ColorRGB const * palette, uint8_t paletteOffset, bool transparent, bool flipV = false) const {
+            uint8_t const * column = pixelBuffer_ + pixelBufferColumnOffset<COLOR>(WIDTH, HEIGHT, x);
+            if (!flipV && (BPP != 4 || ((y | n) & 1) == 0)) {
+                if (transparent && BPP != 16)
+                    return pixelBufferToRGBTransparent<COLOR>(column + y * BPP / 8, buffer, n, palette, paletteOffset);
+                else
+                    return pixelBufferToRGB<COLOR>(column + y * BPP / 8, buffer, n, palette, paletteOffset);
+            }
+            for (Coord i = 0; i < n; ++i, ++buffer) {
+                Coord py = flipV ? (HEIGHT - 1 - y - i) : (y + i);
+                if constexpr (BPP == 16) {
+                    *buffer = pixelAt(x, py);
+                } else {
+                    uint8_t c = pixelAt(x, py).toRaw();
+                    if (c != 0 || !transparent)
+                        *buffer = palette[(c + paletteOffset) & 0xff];
+                }
+            }
+            return buffer;
+        }
+
     private:
 
         uint8_t pixelBuffer_[pixelBufferSize<COLOR>(WIDTH, HEIGHT)];
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+
+#include "../rckid.h"
+#include "tile.h"
+#include "render_pipeline.h"
+
+namespace rckid {
+
+    /** Tile map entry.
+
+        Identifies the tile in the tileset and how it should be drawn, i.e. its palette offset and whether the tile is flipped.
+     */
+    struct TileMapInfo {
+        static constexpr uint8_t FlipH = 1;
+        static constexpr uint8_t FlipV = 2;
+
+        uint16_t tile = 0;
+        uint8_t paletteOffset = 0;
+        uint8_t flags = 0;
+
+        bool flipH() const { return flags & FlipH; }
+        bool flipV() const { return flags & FlipV; }
+    }; // rckid::TileMapInfo
+
+    static_assert(sizeof(TileMapInfo) == 4);
+
+    /** Tile map engine with multiple scrollable layers.
+
+        Each layer is a tile map of arbitrary size with its own tileset and scroll offset. Maps wrap around, so they can be larger or smaller than the screen and scrolling past their edges simply continues from the other side. Layers are drawn from the first to the last, the first visible layer is opaque and in all layers above it the palette color 0 is transparent, which makes it possible to scroll each layer at different speed for parallax effects. Layers can also have per-column vertical scroll, i.e. an array of offsets added to the layer's vertical scroll for each screen column, for raster effects such as waves. Given the column-first display, there is no per-row horizontal scroll.
+
+        Like the UITileEngine, the engine is rendered column by column, so that no framebuffer is necessary, and only the tile maps need to be in RAM, while the tilesets can live in ROM.
+     */
+    template<typename TILE, uint32_t LAYERS = 2>
+    class TileMapEngine : public PaletteHolder<typename TILE::Color> {
+    public:
+
+        static_assert(LAYERS >= 1 && LAYERS <= 4);
+
+        using Tile = TILE;
+        using Color = typename TILE::Color;
+
+        static constexpr uint32_t NumLayers = LAYERS;
+
+        /** Single layer of the engine.
+         */
+        class Layer {
+        public:
+
+            Layer() = default;
+
+            Layer(Layer const &) = delete;
+
+            Layer(Layer && from):
+                tiles_{from.tiles_},
+                map_{from.map_},
+                w_{from.w_},
+                h_{from.h_},
+                scrollX_{from.scrollX_},
+                scrollY_{from.scrollY_},
+                columnScroll_{from.columnScroll_},
+                visible_{from.visible_} {
+                from.map_ = nullptr;
+            }
+
+            ~Layer() {
+                delete [] map_;
+            }
+
+            /** Width of the map in tiles.
+             */
+            Coord width() const { return w_; }
+
+            /** Height of the map in tiles.
+             */
+            Coord height() const { return h_; }
+
+            Coord pixelWidth() const { return w_ * Tile::Width; }
+            Coord pixelHeight() const { return h_ * Tile::Height; }
+
+            /** Resizes the map to given number of tiles, clearing its contents.
+             */
+            void resize(Coord width, Coord height) {
+                ASSERT(width > 0 && height > 0);
+                delete [] map_;
+                w_ = width;
+                h_ = height;
+                map_ = new TileMapInfo[width * height];
+            }
+
+            Tile const * tiles() const { return tiles_; }
+            void setTiles(Tile const * tiles) { tiles_ = tiles; }
+
+            bool visible() const { return visible_; }
+            void setVisible(bool value) { visible_ = value; }
+
+            Coord scrollX() const { return scrollX_; }
+            Coord scrollY() const { return scrollY_; }
+
+            /** Sets the map coordinates displayed at the top-left corner of the screen. The coordinates wrap around the map.
+             */
+            void setScroll(Coord x, Coord y) {
+                scrollX_ = wrap(x, pixelWidth());
+                scrollY_ = wrap(y, pixelHeight());
+            }
+
+            void scrollBy(Coord dx, Coord dy) { setScroll(scrollX_ + dx, scrollY_ + dy); }
+
+            /** Sets the per-column vertical scroll, i.e. the array of offsets (one for each screen column, left to right) that are added to the vertical scroll of the layer. The array is not copied and nullptr disables the per-column scroll.
+             */
+            void setColumnScroll(Coord const * offsets) { columnScroll_ = offsets; }
+
+            TileMapInfo const & at(Coord x, Coord y) const { return map_[y + x * h_]; }
+            TileMapInfo & at(Coord x, Coord y) { return map_[y + x * h_]; }
+
+            /** Fills the entire map with given tile.
+             */
+            void fill(TileMapInfo tile) {
+                for (int i = 0, e = w_ * h_; i != e; ++i)
+                    map_[i] = tile;
+            }
+
+        private:
+
+            friend class TileMapEngine;
+
+            static Coord wrap(Coord x, Coord size) {
+                x = x % size;
+                return (x < 0) ? x + size : x;
+            }
+
+            /** Renders given screen column of the layer. The column is made of runs of pixels from consecutive tiles of the same map column, the first and last of which may be partial.
+             */
+            void renderColumn(Coord column, ColorRGB * buffer, Coord height, ColorRGB const * palette, bool transparent) const {
+                Coord x = wrap(column + scrollX_, pixelWidth());
+                Coord tx = x / Tile::Width;
+                Coord cx = x % Tile::Width;
+                Coord y = scrollY_;
+                if (columnScroll_ != nullptr)
+                    y = wrap(y + columnScroll_[column], pixelHeight());
+                Coord mapHeight = pixelHeight();
+                while (height > 0) {
+                    Coord ty = y / Tile::Height;
+                    Coord cy = y % Tile::Height;
+                    Coord n = std::min(Tile::Height - cy, height);
+                    TileMapInfo const & t = at(tx, ty);
+                    tiles_[t.tile].renderColumn(t.flipH() ? (Tile::Width - 1 - cx) : cx, cy, n, buffer, palette, t.paletteOffset, transparent, t.flipV());
+                    buffer += n;
+                    height -= n;
+                    y += n;
+                    if (y >= mapHeight)
+                        y = 0;
+                }
+            }
+
+            Tile const * tiles_ = nullptr;
+            TileMapInfo * map_ = nullptr;
+            Coord w_ = 0;
+            Coord h_ = 0;
+            Coord scrollX_ = 0;
+            Coord scrollY_ = 0;
+            Coord const * columnScroll_ = nullptr;
+            bool visible_ = true;
+
+        }; // TileMapEngine::Layer
+
+        /** Creates the engine that renders width x height pixels. The layers are empty and must be resized and given tilesets before the engine can be rendered.
+         */
+        TileMapEngine(Coord width, Coord height, ColorRGB const * palette = nullptr):
+            PaletteHolder<Color>{palette},
+            w_{width},
+            h_{height} {
+            ASSERT(width > 0 && width <= 320);
+            ASSERT(height > 0 && height <= 240);
+        }
+
+        TileMapEngine(TileMapEngine const &) = delete;
+        TileMapEngine(TileMapEngine &&) = default;
+
+        Coord width() const { return w_; }
+        Coord height() const { return h_; }
+
+        Layer & layer(uint32_t index) { ASSERT(index < LAYERS); return layers_[index]; }
+        Layer const & layer(uint32_t index) const { ASSERT(index < LAYERS); return layers_[index]; }
+
+        /** Renders given screen column (0 being the leftmost) into the buffer, which must be height() pixels long.
+         */
+        void renderColumn(Coord column, ColorRGB * buffer) const {
+            bool transparent = false;
+            for (Layer const & l : layers_) {
+                if (!l.visible_ || l.map_ == nullptr)
+                    continue;
+                l.renderColumn(column, buffer, h_, this->palette(), transparent);
+                transparent = true;
+            }
+        }
+
+    private:
+
+        Coord w_;
+        Coord h_;
+        Layer layers_[LAYERS];
+
+    }; // rckid::TileMapEngine
+
+    /** Renderer for the tile map engine.
+
+        Like the UITileEngine renderer, renders the engine column by column from right to left, sending the columns to the display in chunks by the RenderPipeline.
+     */
+    template<typename TILE, uint32_t LAYERS>
+    class Renderer<TileMapEngine<TILE, LAYERS>> {
+    public:
+
+        void initialize(TileMapEngine<TILE, LAYERS> const & te) {
+            displaySetMode(DisplayMode::Native);
+            displaySetUpdateRegion(te.width(), te.height());
+            pipeline_.initialize(te.height());
+        }
+
+        void finalize() {
+            pipeline_.finalize();
+        }
+
+        void render(TileMapEngine<TILE, LAYERS> const & te) {
+            pipeline_.render(0, te.width(), te.height(), [&](Coord column, ColorRGB * buffer) {
+                te.renderColumn(column, buffer);
+            });
+        }
+
+    private:
+
+        RenderPipeline pipeline_;
+
+    }; // rckid::Renderer<TileMapEngine>
+
+} // namespace rckid
@@ -12,4 +12,14 @@ namespace rckid {
      */
     void bsod(uint32_t error, uint32_t line, char const * file, char const * extras = nullptr);
 
+#if defined (ARCH_FANTASY)
+    /** Receives a physical display pixel and its coordinates, see displayCapture().
+     */
+    using DisplayCaptureCallback = std::function<void(Coord x, Coord y, ColorRGB const & color)>;
+
+    /** Fantasy backend only. While set, every pixel written by displayUpdate() is passed to the callback with its physical display coordinates instead of being drawn in the window, so that tests can check what the renderers send to the display without opening one. Set to nullptr to draw in the window again.
+     */
+    void displayCapture(DisplayCaptureCallback callback);
+#endif
+
 } // namespace rckid
@@ -1,13 +1,20 @@
+#include <cstring>
+
 #include "rckid.h"
 
+#if (defined RCKID_MEMORY_PROFILER && defined ARCH_FANTASY && defined __linux__)
+    #include <execinfo.h>
+    #define RCKID_MEMORY_PROFILER_SITES
+#endif
+
 #if (defined ARCH_FANTASY)
-    char fantasyHeap[520 * 1024];
+    alignas(8) char fantasyHeap[520 * 1024];
     char & __bss_end__ = *fantasyHeap;
     char & __StackLimit = *(fantasyHeap + sizeof(fantasyHeap));
 #else
     // beginning of the heap
     extern char __bss_end__;
-    // end of the heap 
+    // end of the heap
     extern char __StackLimit;
 #endif
 
@@ -15,101 +22,407 @@ namespace {
 
     using ChunkHeader = uint32_t;
 
-    /** Memory chunk. 
-     
-        Each chunk contains its size, followed by the actual data of the chunk (the user available allocated memory )
+    /** Memory chunk.
+
+        Each chunk contains its size, followed by the actual data of the chunk (the user available allocated memory ). Chunk headers are placed 4 bytes below an 8 byte boundary and header + data is always a multiple of 8 so that the data of every chunk is 8 byte aligned. The lowest two bits of the size are thus always zero and are used as flags - whether the chunk itself is free and whether the chunk immediately before it is free.
+
+        Free chunks use the beginning of their data for the next and previous pointers in their size class bin and the last 4 bytes of their data as a footer that repeats the chunk size (a boundary tag). This way when a chunk is freed, both its neighbours can be found in O(1) and merged with it.
      */
-    PACKED(struct Chunk {
-        uint32_t size;
-        Chunk * next;
+    struct Chunk {
+        ChunkHeader header;
 
-        Chunk(uint32_t size): size{size} {}
+        static constexpr ChunkHeader FREE = 1;
+        static constexpr ChunkHeader PREV_FREE = 2;
+        static constexpr ChunkHeader FLAGS = FREE | PREV_FREE;
+
+        uint32_t size() const { return header & ~FLAGS; }
+        void setSize(uint32_t size) { header = size | (header & FLAGS); }
+
+        bool isFree() const { return header & FREE; }
+        bool isPrevFree() const { return header & PREV_FREE; }
 
         char * start() {
             return reinterpret_cast<char*>(this);
         }
 
-        /** Returns the pointer past the end of the chunk. which is the address of the chunk + the chunk header + chunk size. 
+        /** Returns the pointer past the end of the chunk. which is the address of the chunk + the chunk header + chunk size.
          */
         char * end() {
-            return start() + sizeof(ChunkHeader) + size;
+            return start() + sizeof(ChunkHeader) + size();
         }
 
         size_t allocatedSize() {
-            return size;
+            return size();
+        }
+
+        void * ptr() {
+            return start() + sizeof(ChunkHeader);
+        }
+
+        /** Next and previous chunks in the same bin, only valid for free chunks.
+         */
+        Chunk * & next() { return static_cast<Chunk **>(ptr())[0]; }
+        Chunk * & prev() { return static_cast<Chunk **>(ptr())[1]; }
+
+        /** Returns the chunk immediately following this one. Only valid if this is not the last chunk before heap end.
+         */
+        Chunk * nextChunk() {
+            return reinterpret_cast<Chunk *>(end());
+        }
+
+        /** Returns the chunk immediately before this one, which must be free (its size is read from its footer).
+         */
+        Chunk * prevChunk() {
+            uint32_t prevSize = *reinterpret_cast<uint32_t *>(start() - sizeof(uint32_t));
+            return reinterpret_cast<Chunk *>(start() - prevSize - sizeof(ChunkHeader));
+        }
+
+        void writeFooter() {
+            *reinterpret_cast<uint32_t *>(end() - sizeof(uint32_t)) = size();
+        }
+
+        static Chunk * fromPtr(void * ptr) {
+            return reinterpret_cast<Chunk *>(static_cast<char*>(ptr) - sizeof(ChunkHeader));
         }
 
-    });
+    };
+
+    /** Alignment of the chunk data. Chunk sizes are always rounded so that header + data is a multiple of the alignment.
+     */
+    constexpr uint32_t CHUNK_ALIGNMENT = 8;
+
+    constexpr uint32_t alignChunkSize(size_t numBytes) {
+        return static_cast<uint32_t>(((numBytes + sizeof(ChunkHeader) + CHUNK_ALIGNMENT - 1) & ~(CHUNK_ALIGNMENT - 1)) - sizeof(ChunkHeader));
+    }
+
+    /** Smallest chunk size, a free chunk must be able to hold the bin pointers and the footer.
+     */
+    constexpr uint32_t MIN_CHUNK_SIZE = alignChunkSize(sizeof(Chunk *) * 2 + sizeof(uint32_t));
+
+    /** Chunks below this size have their own exact size bins, one for every alignment step, so that small allocations, which are by far the most frequent, are an O(1) exact fit.
+     */
+    constexpr uint32_t SMALL_CHUNK_LIMIT = 128;
+    constexpr uint32_t NUM_SMALL_BINS = SMALL_CHUNK_LIMIT / CHUNK_ALIGNMENT;
+
+    /** Larger chunks are binned by powers of two, i.e. [132, 252], [260, 508], etc. The last bin holds everything from 256KB up, which is more than enough for the 520KB heap.
+     */
+    constexpr uint32_t LARGE_BINS_START_BIT = 7; // log2(SMALL_CHUNK_LIMIT)
+    constexpr uint32_t NUM_LARGE_BINS = 12;
+    constexpr uint32_t NUM_BINS = NUM_SMALL_BINS + NUM_LARGE_BINS;
+
+    static_assert((1 << LARGE_BINS_START_BIT) == SMALL_CHUNK_LIMIT);
+    static_assert(NUM_BINS <= 64, "bin occupancy must fit in the 64bit mask");
 
-    static_assert(sizeof(Chunk) == sizeof(ChunkHeader) + sizeof(Chunk*));
+    uint32_t roundChunkSize(size_t numBytes) {
+        return numBytes < MIN_CHUNK_SIZE ? MIN_CHUNK_SIZE : alignChunkSize(numBytes);
+    }
+
+    /** Returns the bin index for given (rounded) chunk size.
+     */
+    uint32_t binIndex(uint32_t size) {
+        if (size < SMALL_CHUNK_LIMIT)
+            return (size + sizeof(ChunkHeader)) / CHUNK_ALIGNMENT - 1;
+        uint32_t log2 = 31 - __builtin_clz(size);
+        uint32_t index = NUM_SMALL_BINS + log2 - LARGE_BINS_START_BIT;
+        return index < NUM_BINS ? index : NUM_BINS - 1;
+    }
 
     /** Memory Arena
-     
-        Contains a pointer to the previous arena and its own freelist. so that when the arena is removed, previous freelist can be restored.
+
+        Contains a pointer to the previous arena, list of hooks to notify when the arena is left and its own size class bins, so that when the arena is removed, previous bins are restored. Small bins contain only chunks of the exact size, large bins contain chunks from a power of two range. The bin mask has a bit set for every non-empty bin so that the first non-empty bin that can satisfy a request can be found without scanning.
+
+        The first chunk in an arena never has its PREV_FREE flag set, so coalescing never crosses the arena header.
      */
     struct Arena {
-        Chunk * freelist = nullptr;
+        Chunk * bins[NUM_BINS] = {};
+        uint64_t binMask = 0;
+        rckid::ArenaHook * hooks = nullptr;
         Arena * previous;
+#if (defined RCKID_MEMORY_PROFILER)
+        uint32_t liveBytes = 0;
+        uint32_t peakLiveBytes = 0;
+#endif
 
         explicit Arena(Arena * prev): previous{prev} {}
-    }; 
 
-    static_assert(sizeof(Arena) == sizeof(void*) * 2);
+        void push(Chunk * chunk) {
+            uint32_t bin = binIndex(chunk->size());
+            chunk->prev() = nullptr;
+            chunk->next() = bins[bin];
+            if (chunk->next() != nullptr)
+                chunk->next()->prev() = chunk;
+            bins[bin] = chunk;
+            binMask |= (1ull << bin);
+        }
+
+        void remove(Chunk * chunk) {
+            uint32_t bin = binIndex(chunk->size());
+            if (chunk->prev() == nullptr)
+                bins[bin] = chunk->next();
+            else
+                chunk->prev()->next() = chunk->next();
+            if (chunk->next() != nullptr)
+                chunk->next()->prev() = chunk->prev();
+            if (bins[bin] == nullptr)
+                binMask &= ~(1ull << bin);
+        }
+
+        /** Removes the first chunk in given bin that is at least size bytes large. Returns nullptr if there is no such chunk. For small bins and for any bin larger than the one size belongs to the first chunk is always returned.
+         */
+        Chunk * take(uint32_t bin, uint32_t size) {
+            Chunk * chunk = bins[bin];
+            while (chunk != nullptr && chunk->size() < size)
+                chunk = chunk->next();
+            if (chunk != nullptr)
+                remove(chunk);
+            return chunk;
+        }
+    };
+
+    /** Space taken by the arena header. Arenas start at 8 byte boundary, i.e. 4 bytes after heap end, and the heap end after the arena header is again 4 bytes below 8 byte boundary, ready for the first chunk.
+     */
+    constexpr uint32_t ARENA_SIZE = (sizeof(Arena) + CHUNK_ALIGNMENT - 1) & ~(CHUNK_ALIGNMENT - 1);
 
     Arena * arena = new (__builtin_assume_aligned(&__bss_end__, 8)) Arena{nullptr};
-    char * heapEnd = & __bss_end__ + sizeof(Arena);
+    char * heapEnd = & __bss_end__ + ARENA_SIZE + sizeof(ChunkHeader);
 
     uint32_t mallocCalls = 0;
     uint32_t freeCalls = 0;
 
+#if (defined RCKID_MEMORY_PROFILER)
+    /** Allocations are bucketed by the requested size into powers of two, i.e. up to 8 bytes, up to 16 bytes, etc. The last bucket holds everything above 128KB.
+     */
+    constexpr uint32_t PROFILER_BUCKETS = 16;
+    uint32_t sizeHistogram[PROFILER_BUCKETS] = {};
+    uint32_t peakUsedHeap = 0;
+
+#if (defined RCKID_MEMORY_PROFILER_SITES)
+    /** On the fantasy console, allocation sites are identified by the top few frames of their backtrace, which can be resolved by addr2line. The first frames belong to the allocator itself (depending on inlining) and are identical for all sites. Only the first sites seen are tracked, the rest is counted together.
+     */
+    constexpr int PROFILER_SITE_DEPTH = 8;
+    constexpr int PROFILER_SKIP_FRAMES = 1;
+    constexpr uint32_t PROFILER_MAX_SITES = 32;
+
+    struct AllocationSite {
+        void * frames[PROFILER_SITE_DEPTH];
+        uint32_t count;
+        uint32_t bytes;
+    };
+
+    AllocationSite sites[PROFILER_MAX_SITES];
+    uint32_t numSites = 0;
+    uint32_t otherSitesCount = 0;
+    bool capturingSite = false;
+
+    __attribute__((noinline)) void recordSite(uint32_t size) {
+        // backtrace allocates when called for the first time
+        if (capturingSite)
+            return;
+        capturingSite = true;
+        void * frames[PROFILER_SKIP_FRAMES + PROFILER_SITE_DEPTH] = {};
+        backtrace(frames, PROFILER_SKIP_FRAMES + PROFILER_SITE_DEPTH);
+        capturingSite = false;
+        void ** site = frames + PROFILER_SKIP_FRAMES;
+        for (uint32_t i = 0; i < numSites; ++i) {
+            if (memcmp(sites[i].frames, site, sizeof(AllocationSite::frames)) == 0) {
+                ++sites[i].count;
+                sites[i].bytes += size;
+                return;
+            }
+        }
+        if (numSites == PROFILER_MAX_SITES) {
+            ++otherSitesCount;
+            return;
+        }
+        memcpy(sites[numSites].frames, site, sizeof(AllocationSite::frames));
+        sites[numSites].count = 1;
+        sites[numSites].bytes = size;
+        ++numSites;
+    }
+#endif
+#endif
+
+    /** Updates the live bytes of the current arena and the peaks when a chunk changes its size from oldSize to newSize.
+     */
+    void profileResize([[maybe_unused]] uint32_t oldSize, [[maybe_unused]] uint32_t newSize) {
+#if (defined RCKID_MEMORY_PROFILER)
+        arena->liveBytes = arena->liveBytes + newSize - oldSize;
+        if (arena->liveBytes > arena->peakLiveBytes)
+            arena->peakLiveBytes = arena->liveBytes;
+        if (rckid::memoryUsedHeap() > peakUsedHeap)
+            peakUsedHeap = rckid::memoryUsedHeap();
+#endif
+    }
+
+    void profileAlloc([[maybe_unused]] Chunk * chunk, [[maybe_unused]] size_t numBytes) {
+#if (defined RCKID_MEMORY_PROFILER)
+        uint32_t bucket = numBytes <= 8 ? 0 : 29 - __builtin_clz(static_cast<uint32_t>(numBytes - 1));
+        ++sizeHistogram[bucket < PROFILER_BUCKETS ? bucket : PROFILER_BUCKETS - 1];
+        profileResize(0, chunk->size());
+#if (defined RCKID_MEMORY_PROFILER_SITES)
+        recordSite(chunk->size());
+#endif
+#endif
+    }
+
+    void profileFree(Chunk * chunk) {
+        profileResize(chunk->size(), 0);
+    }
+
+    /** Marks the chunk as free, writes its footer and adds it to the arena's bins. The chunk must not be the last chunk before heap end.
+     */
+    void releaseChunk(Chunk * chunk) {
+        chunk->header |= Chunk::FREE;
+        chunk->writeFooter();
+        chunk->nextChunk()->header |= Chunk::PREV_FREE;
+        arena->push(chunk);
+    }
+
+    /** Trims used chunk to given size. If the chunk is the last one, the heap end is simply moved, otherwise the remainder, if large enough to form a chunk of its own, is merged with the next chunk if free and returned to the bins.
+     */
+    void trimChunk(Chunk * chunk, uint32_t size) {
+        if (chunk->end() == heapEnd) {
+            chunk->setSize(size);
+            heapEnd = chunk->end();
+            return;
+        }
+        if (chunk->size() < size + sizeof(ChunkHeader) + MIN_CHUNK_SIZE)
+            return;
+        Chunk * rest = reinterpret_cast<Chunk *>(chunk->start() + sizeof(ChunkHeader) + size);
+        rest->header = chunk->size() - size - sizeof(ChunkHeader);
+        chunk->setSize(size);
+        Chunk * next = rest->nextChunk();
+        if (next->isFree()) {
+            arena->remove(next);
+            rest->setSize(rest->size() + sizeof(ChunkHeader) + next->size());
+        }
+        releaseChunk(rest);
+    }
+
+    /** Marks chunk taken from the bins as used and splits it so that it is only size bytes large. Free chunks are never last before heap end and never have free neighbours so the chunk always has a next chunk, which is in use.
+     */
+    void useChunk(Chunk * chunk, uint32_t size) {
+        chunk->header &= ~Chunk::FREE;
+        chunk->nextChunk()->header &= ~Chunk::PREV_FREE;
+        trimChunk(chunk, size);
+    }
+
+    /** Returns the chunk to the heap, merging it with its free neighbours.
+     */
+    void freeChunk(Chunk * chunk) {
+        ASSERT(! chunk->isFree());
+        // merge with the previous chunk if free (that chunk's own PREV_FREE is never set as free chunks are always merged)
+        if (chunk->isPrevFree()) {
+            Chunk * prev = chunk->prevChunk();
+            arena->remove(prev);
+            prev->setSize(prev->size() + sizeof(ChunkHeader) + chunk->size());
+            prev->header &= ~Chunk::FREE;
+            chunk = prev;
+        }
+        // if this is the last allocated memory chunk, simply update the heap end
+        if (chunk->end() == heapEnd) {
+            heapEnd = chunk->start();
+            TRACE_MEMORY("deallocating last chunk, free " << rckid::memoryFreeHeap());
+            return;
+        }
+        // merge with next chunk if free, which can never be the last chunk
+        Chunk * next = chunk->nextChunk();
+        if (next->isFree()) {
+            arena->remove(next);
+            chunk->setSize(chunk->size() + sizeof(ChunkHeader) + next->size());
+        }
+        // add the chunk to its size class bin
+        releaseChunk(chunk);
+        TRACE_MEMORY("deallocating and adding to bin " << binIndex(chunk->size()) << ", free " << rckid::memoryFreeHeap());
+    }
+
 } // anonymous namespace for memory functions
 
 extern "C" {
     void *__wrap_malloc(size_t numBytes) {
         ++mallocCalls;
-        Chunk * freeChunk = arena->freelist;
-        Chunk * last = nullptr;
-        // see if we can use a chunk from freelist
-        while (freeChunk != nullptr) {
-            if (freeChunk->size >= numBytes) {
-                if (last == nullptr)
-                    arena->freelist = freeChunk->next;
-                else 
-                    last->next = freeChunk->next;
-                TRACE_MEMORY("allocating " << numBytes<< " from existing chunk");
-                return & freeChunk->next;
+        uint32_t size = roundChunkSize(numBytes);
+        uint32_t bin = binIndex(size);
+        // exact fit for small bins, first fit within the bin for large bins
+        Chunk * chunk = arena->take(bin, size);
+        if (chunk == nullptr) {
+            // any chunk from the next non-empty bin is large enough
+            uint64_t larger = arena->binMask & ~((2ull << bin) - 1);
+            if (larger != 0)
+                chunk = arena->take(__builtin_ctzll(larger), size);
+        }
+        if (chunk != nullptr) {
+            useChunk(chunk, size);
+            TRACE_MEMORY("allocating " << numBytes<< " from existing chunk of " << chunk->size());
+        } else {
+            // we haven't found anything in the bins, use the end of the heap to create one and advance the heap end. The chunk before heap end is never free, so no flags are set
+            chunk = (Chunk*) heapEnd;
+            heapEnd += size + sizeof(ChunkHeader);
+            // if we are over the limit, panic
+            ASSERT(heapEnd <= & __StackLimit);
+            // set the chunk's size
+            chunk->header = size;
+            TRACE_MEMORY("allocating " << numBytes<< " from heap, free " << rckid::memoryFreeHeap());
+        }
+        profileAlloc(chunk, numBytes);
+        return chunk->ptr();
+    }
+
+    void * __wrap_calloc(size_t numItems, size_t itemSize) {
+        size_t numBytes = numItems * itemSize;
+        ASSERT(itemSize == 0 || numBytes / itemSize == numItems);
+        void * result = __wrap_malloc(numBytes);
+        memset(result, 0, numBytes);
+        return result;
+    }
+
+    void * __wrap_realloc(void * ptr, size_t numBytes) {
+        if (ptr == nullptr)
+            return __wrap_malloc(numBytes);
+        ASSERT(ptr > arena);
+        Chunk * chunk = Chunk::fromPtr(ptr);
+        uint32_t oldSize = chunk->size();
+        uint32_t size = roundChunkSize(numBytes);
+        // the last chunk can be resized freely by moving the heap end
+        if (chunk->end() == heapEnd) {
+            ASSERT(chunk->start() + sizeof(ChunkHeader) + size <= & __StackLimit);
+            trimChunk(chunk, size);
+            profileResize(oldSize, chunk->size());
+            TRACE_MEMORY("reallocating last chunk to " << numBytes << ", free " << rckid::memoryFreeHeap());
+            return ptr;
+        }
+        // grow into the next chunk if it is free and large enough, otherwise allocate new chunk and copy
+        if (size > chunk->size()) {
+            Chunk * next = chunk->nextChunk();
+            if (! next->isFree() || chunk->size() + sizeof(ChunkHeader) + next->size() < size) {
+                void * result = __wrap_malloc(numBytes);
+                memcpy(result, ptr, chunk->size());
+                ++freeCalls;
+                profileFree(chunk);
+                freeChunk(chunk);
+                TRACE_MEMORY("reallocating " << numBytes << " by copying");
+                return result;
             }
-            last = freeChunk;
-            freeChunk = freeChunk->next;
+            arena->remove(next);
+            chunk->setSize(chunk->size() + sizeof(ChunkHeader) + next->size());
+            chunk->nextChunk()->header &= ~Chunk::PREV_FREE;
         }
-        // we haven't found anything in the freelist, use the end of the heap to create one and advance the heap end
-        Chunk * result = (Chunk*) heapEnd;
-        heapEnd += numBytes + sizeof(ChunkHeader); 
-        // if we are over the limit, panic
-        ASSERT(heapEnd <= & __StackLimit);
-        // set the chunk's size and return it 
-        result->size = static_cast<uint32_t>(numBytes);
-        TRACE_MEMORY("allocating " << numBytes<< " from heap, free " << rckid::memoryFreeHeap());
-        return &(result->next);
+        // the chunk is now large enough, return any excess
+        trimChunk(chunk, size);
+        profileResize(oldSize, chunk->size());
+        TRACE_MEMORY("reallocating " << numBytes << " in place");
+        return ptr;
     }
 
     void __wrap_free(void * ptr) {
+        if (ptr == nullptr)
+            return;
         // check that we are freeing memory that is higher than the current arena, otherwise we are freeing from a previous arena which is wrong
-        ASSERT(ptr > arena); 
+        ASSERT(ptr > arena);
         ++freeCalls;
-        // deal with the chunk
-        Chunk * chunk = (Chunk *)((char*) ptr - 4);
-        // if this is the last allocated memory chunk, simply update the heap end
-        if (chunk->end() == heapEnd) {
-            heapEnd = chunk->start();
-            TRACE_MEMORY("deallocating last chunk, free " << rckid::memoryFreeHeap());
-            return;
-        }
-        // get the chunk and prepend it to the freelist
-        // TODO this is extremely ugly and inefficient, must be fixed in the future
-        chunk->next = arena->freelist;
-        arena->freelist = chunk;
-        TRACE_MEMORY("deallocating and adding to freelist, free " << rckid::memoryFreeHeap());
+        Chunk * chunk = Chunk::fromPtr(ptr);
+        profileFree(chunk);
+        freeChunk(chunk);
     }
 
 }
@@ -136,8 +449,9 @@ namespace rckid {
     }
 
     void memoryEnterArena() {
-        arena = new (heapEnd) Arena{arena};
-        heapEnd += sizeof (Arena);
+        // padding to 8 byte boundary before the arena and padding for the first chunk header after it
+        arena = new (heapEnd + sizeof(ChunkHeader)) Arena{arena};
+        heapEnd = reinterpret_cast<char*>(arena) + ARENA_SIZE + sizeof(ChunkHeader);
         TRACE_MEMORY("Entering arena @" << (void*)(arena) << ", free " << memoryFreeHeap());
     }
 
@@ -146,13 +460,139 @@ namespace rckid {
         // TODO BSOD in debug mode, do nothing in production
         if (arena->previous == nullptr)
             return;
-        heapEnd = reinterpret_cast<char*>(arena);
+        for (ArenaHook * hook = arena->hooks; hook != nullptr; hook = hook->nextHook_)
+            hook->onArenaLeave();
+        heapEnd = reinterpret_cast<char*>(arena) - sizeof(ChunkHeader);
         arena = arena->previous;
         TRACE_MEMORY("Current arena @" << (void*)(arena) << ", free " << memoryFreeHeap());
     }
 
+    ArenaHook::ArenaHook(ArenaHook && from) {
+        for (Arena * a = arena; a != nullptr; a = a->previous) {
+            for (ArenaHook ** h = & a->hooks; *h != nullptr; h = & (*h)->nextHook_) {
+                if (*h == & from) {
+                    *h = this;
+                    nextHook_ = from.nextHook_;
+                    from.nextHook_ = nullptr;
+                    return;
+                }
+            }
+        }
+    }
+
+    uint32_t memoryMallocCalls() { return mallocCalls; }
+
+    uint32_t memoryFreeCalls() { return freeCalls; }
+
+    MemoryFragmentation memoryFragmentation() {
+        MemoryFragmentation result;
+        result.freeBytes = memoryFreeHeap();
+        result.largestFreeBlock = result.freeBytes;
+        for (uint32_t i = 0; i < NUM_BINS; ++i) {
+            for (Chunk * chunk = arena->bins[i]; chunk != nullptr; chunk = chunk->next()) {
+                result.freeBytes += chunk->size();
+                ++result.freeChunks;
+                if (chunk->size() > result.largestFreeBlock)
+                    result.largestFreeBlock = chunk->size();
+            }
+        }
+        return result;
+    }
+
+    void memoryProfileDump() {
+        MemoryFragmentation f = memoryFragmentation();
+        debugWrite() << "memory: malloc calls " << mallocCalls << ", free calls " << freeCalls << "\n";
+        debugWrite() << "memory: used " << memoryUsedHeap() << ", free " << memoryFreeHeap() << ", free in chunks " << (f.freeBytes - memoryFreeHeap()) << " (" << f.freeChunks << " chunks)\n";
+        debugWrite() << "memory: largest free block " << f.largestFreeBlock << ", fragmentation " << f.percent() << "%\n";
+#if (defined RCKID_MEMORY_PROFILER)
+        debugWrite() << "memory: peak used " << peakUsedHeap << "\n";
+        for (uint32_t i = 0; i < PROFILER_BUCKETS; ++i)
+            if (sizeHistogram[i] != 0)
+                debugWrite() << "memory:   " << ((i == PROFILER_BUCKETS - 1) ? "> " : "<= ") << ((i == PROFILER_BUCKETS - 1) ? (8u << (i - 1)) : (8u << i)) << ": " << sizeHistogram[i] << "\n";
+        for (Arena * a = arena; a != nullptr; a = a->previous)
+            debugWrite() << "memory: arena @" << static_cast<void*>(a) << ", live " << a->liveBytes << ", peak " << a->peakLiveBytes << "\n";
+#if (defined RCKID_MEMORY_PROFILER_SITES)
+        for (uint32_t i = 0; i < numSites; ++i) {
+            Writer w = debugWrite();
+            w << "memory: site " << sites[i].count << "x " << sites[i].bytes << " bytes:";
+            // in hex so that the addresses can be passed to addr2line directly
+            for (void * frame : sites[i].frames) {
+                w << " 0x";
+                for (int shift = sizeof(void *) * 8 - 4; shift >= 0; shift -= 4)
+                    w << "0123456789abcdef"[(reinterpret_cast<uintptr_t>(frame) >> shift) & 0xf];
+            }
+            w << "\n";
+        }
+        if (otherSitesCount > 0)
+            debugWrite() << "memory: other sites " << otherSitesCount << "x\n";
+#endif
+#endif
+    }
+
+    void memoryProfileReset() {
+        mallocCalls = 0;
+        freeCalls = 0;
+#if (defined RCKID_MEMORY_PROFILER)
+        memset(sizeHistogram, 0, sizeof(sizeHistogram));
+        peakUsedHeap = memoryUsedHeap();
+        for (Arena * a = arena; a != nullptr; a = a->previous)
+            a->peakLiveBytes = a->liveBytes;
+#if (defined RCKID_MEMORY_PROFILER_SITES)
+        numSites = 0;
+        otherSitesCount = 0;
+#endif
+#endif
+    }
+
+    void memoryAddArenaHook(ArenaHook * hook) {
+        hook->nextHook_ = arena->hooks;
+        arena->hooks = hook;
+    }
+
+    void memoryRemoveArenaHook(ArenaHook * hook) {
+        for (Arena * a = arena; a != nullptr; a = a->previous) {
+            for (ArenaHook ** h = & a->hooks; *h != nullptr; h = & (*h)->nextHook_) {
+                if (*h == hook) {
+                    *h = hook->nextHook_;
+                    hook->nextHook_ = nullptr;
+                    return;
+                }
+            }
+        }
+    }
+
     void * malloc(size_t numBytes) { return __wrap_malloc(numBytes); }
 
+    void * calloc(size_t numItems, size_t itemSize) { return __wrap_calloc(numItems, itemSize); }
+
+    void * realloc(void * ptr, size_t numBytes) { return __wrap_realloc(ptr, numBytes); }
+
+    void * mallocAligned(size_t numBytes, size_t alignment) {
+        ASSERT((alignment & (alignment - 1)) == 0);
+        if (alignment <= CHUNK_ALIGNMENT)
+            return __wrap_malloc(numBytes);
+        // allocate enough memory so that there is an aligned address inside with enough space before it to form a free chunk
+        uint32_t size = roundChunkSize(numBytes);
+        char * raw = static_cast<char *>(__wrap_malloc(size + alignment + sizeof(ChunkHeader) + MIN_CHUNK_SIZE));
+        char * aligned = reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(raw) + alignment - 1) & ~(alignment - 1));
+        if (aligned != raw && aligned - raw < static_cast<ptrdiff_t>(sizeof(ChunkHeader) + MIN_CHUNK_SIZE))
+            aligned += alignment;
+        Chunk * chunk = Chunk::fromPtr(raw);
+        uint32_t rawSize = chunk->size();
+        if (aligned != raw) {
+            // split the chunk at the aligned address and free the leading part
+            uint32_t lead = static_cast<uint32_t>(aligned - raw);
+            Chunk * result = Chunk::fromPtr(aligned);
+            result->header = chunk->size() - lead;
+            chunk->setSize(lead - sizeof(ChunkHeader));
+            freeChunk(chunk);
+            chunk = result;
+        }
+        trimChunk(chunk, size);
+        profileResize(rawSize, chunk->size());
+        return aligned;
+    }
+
     void free(void * ptr) { __wrap_free(ptr); }
 
     char * heapStart() { return & __bss_end__; }
@@ -213,6 +213,8 @@ namespace rckid {
     Rect displayUpdateRegion();
 
     /** Sets the display update region. 
+     
+        In the double modes (DisplayMode::NativeDouble and DisplayMode::NaturalDouble) the region is in the 160x120 coordinates and every pixel is shown as 2x2 block on the display. The display doubles each pixel sent along the update direction (i.e. rows in the native mode), but every column (native) or row (natural) must be sent twice by the renderer. 
      */
     void displaySetUpdateRegion(Rect region);
 
@@ -358,7 +360,7 @@ namespace rckid {
      */
     //@{
 
-    /** Returns free heap available to the application. The actual free heap is likely larger if any allocations were freed, but not returned to the heap.      
+    /** Returns free heap available to the application. Freed chunks are merged with their free neighbours and freeing the topmost chunk returns it, together with any free chunk just below it, to the heap, so only free chunks surrounded by live allocations are not counted.      
      */
     uint32_t memoryFreeHeap();
 
@@ -384,9 +386,21 @@ namespace rckid {
      */
     void memoryLeaveArena();
 
-    /** Allocates new memory on the heap in current arena. 
+    /** Allocates new memory on the heap in current arena. The returned memory is always 8 byte aligned.
      */
     void * malloc(size_t numBytes);
+
+    /** Allocates zero initialized memory for numItems of itemSize bytes each in current arena. 
+     */
+    void * calloc(size_t numItems, size_t itemSize);
+
+    /** Resizes previously allocated chunk of memory. The chunk is resized in place if it is the last chunk on the heap or if it is followed by a free chunk large enough, otherwise new chunk is allocated and the contents copied. Like free(), the chunk must belong to the current arena. 
+     */
+    void * realloc(void * ptr, size_t numBytes);
+
+    /** Allocates memory aligned to the given power of two boundary, such as DMA ring buffers. The memory is freed with free() as usual. 
+     */
+    void * mallocAligned(size_t numBytes, size_t alignment);
  
     /** Frees previously allocated chunk of memory. Note that the chunk *must* belong to the curren arena. 
      */
@@ -395,6 +409,74 @@ namespace rckid {
     /** Returns the beginning of the heap. 
      */
     char * heapStart();
+
+    /** Returns the number of malloc calls since start, or since the last memoryProfileReset().
+     */
+    uint32_t memoryMallocCalls();
+
+    /** Returns the number of free calls since start, or since the last memoryProfileReset().
+     */
+    uint32_t memoryFreeCalls();
+
+    /** Free memory in the current arena, i.e. the free heap and any freed chunks that were not returned to it yet. 
+     */
+    struct MemoryFragmentation {
+        uint32_t freeBytes = 0;
+        uint32_t largestFreeBlock = 0;
+        uint32_t freeChunks = 0;
+
+        /** Returns the fragmentation in percent, i.e. how much of the free memory is not available in the largest free block. 0 means all free memory can be allocated at once. 
+         */
+        uint32_t percent() const { 
+            return freeBytes == 0 ? 0 : 100 - static_cast<uint32_t>(static_cast<uint64_t>(largestFreeBlock) * 100 / freeBytes); 
+        }
+    };
+
+    /** Calculates the fragmentation of the current arena. Walks all free chunks of the arena, so should not be called every frame. 
+     */
+    MemoryFragmentation memoryFragmentation();
+
+    /** Writes the memory statistics to debugWrite(). 
+     
+        By default only the call counters and fragmentation are available. When the SDK is compiled with RCKID_MEMORY_PROFILER defined, the dump also contains the histogram of allocation sizes, live and peak bytes for each arena and the peak heap used. On the fantasy console, the most frequent allocation sites (as backtrace addresses) are reported as well. 
+     */
+    void memoryProfileDump();
+
+    /** Resets the call counters and the profiler's histogram, peaks and allocation sites. 
+     */
+    void memoryProfileReset();
+
+    /** Memory arena hook. 
+     
+        Allocators that carve their memory out of the current arena, such as Pool, register themselves with the arena via memoryAddArenaHook() and are notified when the arena is left, so that they can forget the memory that no longer belongs to them. 
+     */
+    class ArenaHook {
+    public:
+        ArenaHook() = default;
+        ArenaHook(ArenaHook const &) = delete;
+
+        /** Moving a registered hook takes over its place in the arena's hooks. 
+         */
+        ArenaHook(ArenaHook && from);
+
+    protected:
+        /** Called by memoryLeaveArena() before the arena's memory is released. The hook is unregistered automatically afterwards. 
+         */
+        virtual void onArenaLeave() = 0;
+    private:
+        friend void memoryLeaveArena();
+        friend void memoryAddArenaHook(ArenaHook * hook);
+        friend void memoryRemoveArenaHook(ArenaHook * hook);
+        ArenaHook * nextHook_ = nullptr;
+    }; 
+
+    /** Registers the hook with the current arena.
+     */
+    void memoryAddArenaHook(ArenaHook * hook);
+
+    /** Unregisters the hook from whichever arena it has been registered with. Does nothing if the hook is not registered. 
+     */
+    void memoryRemoveArenaHook(ArenaHook * hook);
     //@}
 
 
@@ -2,6 +2,7 @@
 
 #include "../app.h"
 #include "../graphics/canvas.h"
+#include "../graphics/text_layout.h"
 #include "../ui/timer.h"
 
 #include "menu.h"
@@ -25,14 +26,12 @@ namespace rckid {
 
         void setCurrent(char const * text, Surface<ColorRGB> && icon) {
             text_ = text;
-            textWidth_ = font_.textWidth(text);
             icon_ = std::move(icon);
             dir_ = Btn::Home;
         }
 
         void setCurrent(MenuItem const & item) {
             text_ = item.text();
-            textWidth_ = font_.textWidth(text_);
             auto x = item.icon();
             if (x) {
                 icon_ = std::move(*x);
@@ -50,60 +49,63 @@ namespace rckid {
          */
         void drawOn(Surface<ColorRGB> & surface, Rect where) {
             a_.update();
-            Point pos = getItemPosition(icon_, textWidth_, where);
+            // the layouts are only recalculated when the texts change, so this is cheap for all but the first frame of each item
+            layout_.layout(font_, text_);
+            otherLayout_.layout(font_, otherText_);
+            Point pos = getItemPosition(icon_, layout_.width(), where);
             switch (dir_) {
                 // no animation - only display the current icon & text
                 default:
                 case Btn::Home: {
                     drawIcon(surface, pos.x, pos.y, icon_);
-                    drawText(surface, pos.x, pos.y, icon_, text_);
+                    drawText(surface, pos.x, pos.y, icon_, layout_);
                     break;
                 }
                 // other comes from left
                 case Btn::Left: {
-                    Point opos = getItemPosition(otherIcon_, otherTextWidth_, where);  
+                    Point opos = getItemPosition(otherIcon_, otherLayout_.width(), where);  
                     int offset = interpolation::easingCos(a_, 0, where.w);
                     drawIcon(surface, pos.x + offset, pos.y, icon_);
-                    drawText(surface, pos.x + offset * 2, pos.y, icon_, text_);
+                    drawText(surface, pos.x + offset * 2, pos.y, icon_, layout_);
                     drawIcon(surface, opos.x - (where.w - offset) * 2, opos.y, otherIcon_);
-                    drawText(surface, opos.x - (where.w - offset), opos.y, otherIcon_, otherText_);
+                    drawText(surface, opos.x - (where.w - offset), opos.y, otherIcon_, otherLayout_);
                     break;
                 }
                 // other comes from right
                 case Btn::Right: {
-                    Point opos = getItemPosition(otherIcon_, otherTextWidth_, where);    
+                    Point opos = getItemPosition(otherIcon_, otherLayout_.width(), where);    
                     int offset = interpolation::easingCos(a_, 0, where.w);
                     drawIcon(surface, pos.x - offset * 2, pos.y, icon_);
-                    drawText(surface, pos.x - offset, pos.y, icon_, text_);
+                    drawText(surface, pos.x - offset, pos.y, icon_, layout_);
                     drawIcon(surface, opos.x + (where.w - offset), opos.y, otherIcon_);
-                    drawText(surface, opos.x + (where.w - offset) * 2, opos.y, otherIcon_, otherText_);
+                    drawText(surface, opos.x + (where.w - offset) * 2, opos.y, otherIcon_, otherLayout_);
                     break;
                 }
                 // other comes from sides, current goes down (we are moving up in the menu hierarchy)
                 case Btn::Up: {
-                    Point opos = getItemPosition(otherIcon_, otherTextWidth_, where);    
+                    Point opos = getItemPosition(otherIcon_, otherLayout_.width(), where);    
                     int offset = interpolation::easingCos(a_, where.w, 0);
                     drawIcon(surface, opos.x - offset, opos.y, otherIcon_);
-                    drawText(surface, opos.x + offset, opos.y, otherIcon_, otherText_);
+                    drawText(surface, opos.x + offset, opos.y, otherIcon_, otherLayout_);
                     offset = interpolation::easingCos(a_, 0, where.h);
                     drawIcon(surface, pos.x, pos.y + offset, icon_);
-                    drawText(surface, pos.x, pos.y + offset, icon_, text_);
+                    drawText(surface, pos.x, pos.y + offset, icon_, layout_);
                     break;
                 }
                 case Btn::Down: {
-                    Point opos = getItemPosition(otherIcon_, otherTextWidth_, where);    
+                    Point opos = getItemPosition(otherIcon_, otherLayout_.width(), where);    
                     int offset = interpolation::easingCos(a_, 0, where.w);
                     drawIcon(surface, pos.x - offset, pos.y, icon_);
-                    drawText(surface, pos.x + offset, pos.y, icon_, text_);
+                    drawText(surface, pos.x + offset, pos.y, icon_, layout_);
                     offset = interpolation::easingCos(a_, where.h, 0);
                     drawIcon(surface, opos.x, opos.y + offset, otherIcon_);
-                    drawText(surface, opos.x, opos.y + offset, otherIcon_, otherText_);
+                    drawText(surface, opos.x, opos.y + offset, otherIcon_, otherLayout_);
                     break;
                 }
             }
             if (dir_ != Btn::Home && !a_.running()) {
                 std::swap(text_, otherText_);
-                std::swap(textWidth_, otherTextWidth_);
+                std::swap(layout_, otherLayout_);
                 std::swap(icon_, otherIcon_);
                 dir_ = Btn::Home;
             }            
@@ -113,7 +115,6 @@ namespace rckid {
 
         void setOther(MenuItem const & item, Btn dir) {
             otherText_ = item.text();
-            otherTextWidth_ = font_.textWidth(otherText_);
             auto x = item.icon();
             if (x) {
                 otherIcon_ = std::move(*x);
@@ -129,13 +130,11 @@ namespace rckid {
             return Point{left, top};
         }
 
-        void drawText(Surface<ColorRGB> & surface, int x, int y, Surface<ColorRGB> const & icon, char const * text) {
-            if (text == nullptr)
-                return;
+        void drawText(Surface<ColorRGB> & surface, int x, int y, Surface<ColorRGB> const & icon, TextLayout const & text) {
             y += (icon.height() - font_.size) / 2;
             x += icon.width() + 5;
             // TODO does nothing interesting - eventually might scroll the text if too large to fit, etc
-            surface.text(x, y, font_, color::White) << text;
+            text.drawOn(surface, Point{x, y}, color::White);
         }
 
         void drawIcon(Surface<ColorRGB> & surface, int x, int y, Surface<ColorRGB> const & icon) {
@@ -146,8 +145,8 @@ namespace rckid {
 
         char const * text_ = nullptr;
         char const * otherText_ = nullptr;
-        int textWidth_ = 0;
-        int otherTextWidth_ = 0;
+        TextLayout layout_;
+        TextLayout otherLayout_;
         Surface<ColorRGB> icon_{64, 64};
         Surface<ColorRGB> otherIcon_{64, 64}; 
 
@@ -72,9 +72,19 @@ namespace rckid {
             iconSize_{SIZE} {
         }
 
+        /** Creates menu item whose icon is a native 16bpp image asset. Uncompressed icons are then used straight from the asset without decoding (see Surface::fromAsset()).
+         */
+        StaticMenuItem(char const * text, ImageAsset icon, uint32_t payload = 0, void * payloadPtr = nullptr):
+            MenuItem{payload, payloadPtr},
+            text_{text}, 
+            iconAsset_{icon} {
+        }
+
         char const * text() const override { return text_; }
 
         std::optional<Surface<ColorRGB>> icon() const override {
+            if (iconAsset_.has_value())
+                return Surface<ColorRGB>::fromAsset(iconAsset_.value());
             if (iconData_ == nullptr)
                 return std::nullopt;
             return Surface<ColorRGB>::fromImage(PNG::fromBuffer(iconData_, iconSize_));
@@ -84,6 +94,7 @@ namespace rckid {
         char const * text_ = nullptr;
         uint8_t const * iconData_ = nullptr;
         uint32_t iconSize_ = 0;
+        std::optional<ImageAsset> iconAsset_;
 
     }; // rckid::StaticMenuItem
 
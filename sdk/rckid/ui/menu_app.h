@@ -41,6 +41,18 @@ namespace rckid {
             return new StaticMenuItem(text, buffer, SIZE, ITEM_KIND_ACTION, x);
         }
 
+        static MenuItem * Submenu(char const * text, ImageAsset icon, MenuGenerator generator) {
+            void * x = reinterpret_cast<void*>(generator);
+            TRACE_MENU_APP("Created submenu " << text << ", payload " << x);
+            return new StaticMenuItem(text, icon, ITEM_KIND_SUBMENU, x);
+        }
+
+        static MenuItem * Item(char const * text, ImageAsset icon, Action action) {
+            void * x = reinterpret_cast<void*>(action);
+            TRACE_MENU_APP("Created menu item " << text << ", payload " << x);
+            return new StaticMenuItem(text, icon, ITEM_KIND_ACTION, x);
+        }
+
         MenuApp(): 
             GraphicsApp{Canvas<ColorRGB>{320, 240}} {
             carousel_ = new Carousel{Font::fromROM<assets::font::OpenDyslexic48>()}; 
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
+
 #include "../graphics/color.h"
 #include "../graphics/tile.h"
 #include "../graphics/sprite.h"
 #include "../graphics/drawing.h"
+#include "../graphics/render_pipeline.h"
+#include "../app.h"
+#include "../utils/pool.h"
 #include "../assets/tiles/ui-tiles.h"
 
 namespace rckid {
@@ -43,14 +48,15 @@ namespace rckid {
             h_{from.h_}, 
             top_{from.top_},
             tileMap_{from.tileMap_},
-            sprites_{std::move(from.sprites_)} 
+            sprites_{std::move(from.sprites_)},
+            spritePool_{std::move(from.spritePool_)}
         {
             from.tileMap_ = nullptr;
         }
 
         ~UITileEngine() {
             for (Sprite * s : sprites_)
-                delete s;
+                spritePool_.destroy(s);
             delete [] tileMap_;
         }
 
@@ -67,8 +73,11 @@ namespace rckid {
 
         size_t numSprites() const { return sprites_.size(); }
 
+        /** Adds new sprite of given size. At most RCKID_UI_MAX_SPRITES sprites can be added.
+         */
         Sprite & addSprite(int width, int height) {
-            Sprite * s = new Sprite{width, height};
+            ASSERT(sprites_.size() < RCKID_UI_MAX_SPRITES);
+            Sprite * s = spritePool_.create(width, height);
             sprites_.push_back(s);
             return *s;
         }
@@ -106,64 +115,71 @@ namespace rckid {
         Coord top_;
         UITileInfo * tileMap_ = nullptr;
         std::vector<Sprite *> sprites_;
+        Pool<Sprite, RCKID_UI_MAX_SPRITES> spritePool_;
 
     }; 
 
     /** Renderer for the simple tile engine.  
      
-        Simply renders the single tile layer column by column and overlays any sprites. 
+        Simply renders the single tile layer column by column and overlays any sprites. The columns are sent to the display in chunks by the RenderPipeline.
+
+        To avoid asking every sprite about every column, the visible sprites are indexed by their horizontal span at the beginning of each frame. As the columns are rendered from right to left, sprites enter the list of active sprites at their right edge and leave it past their left edge, so that each column only touches the sprites that overlap it. The active sprites are kept ordered by their z-order. 
      */
     template<typename TILE>
     class Renderer<UITileEngine<TILE>> {
     public:
 
-        ~Renderer() {
-            ASSERT(renderBuffer_ == nullptr);
-        }
-
         void initialize(UITileEngine<TILE> const & te) {
             displaySetMode(DisplayMode::Native);
             displaySetUpdateRegion(Rect::XYWH((320 - te.pixelWidth()) / 2, te.top(), te.pixelWidth(), te.pixelHeight()));
-            // create the buffer
-            ASSERT(renderBuffer_ == nullptr);
-            renderBuffer_ = new ColorRGB[te.pixelHeight() * 2];
+            pipeline_.initialize(te.pixelHeight());
         }
 
         void finalize() {
-            ASSERT(renderBuffer_ != nullptr);
-            delete [] renderBuffer_;
-            renderBuffer_ = nullptr;
+            pipeline_.finalize();
         }
 
         void render(UITileEngine<TILE> const & te) {
-            column_ = te.pixelWidth() - 1;
-            renderColumn(column_, te);
-            renderColumn(column_ - 1, te);
-            displayWaitVSync();
-            displayUpdate(getRenderBufferChunk(column_, te), te.pixelHeight(), [&]() {
-                // move to previous (right to left column), if there is none, we are done rendering
-                if (--column_ < 0)
-                    return;
-                // render the column we currently point to (already in the renderBuffer)
-                displayUpdate(getRenderBufferChunk(column_, te), te.pixelHeight());
-                // render the column ahead, if any
-                if (column_ > 0)
-                    renderColumn(column_ - 1, te);
-            });
+            if (App::hasFrameScratch()) {
+                indexSprites(te, App::frameScratch());
+                renderFrame(te);
+            } else {
+                // outside of the app's frame there is no frame scratch, so the index gets its own
+                ScratchArena scratch{indexBytes(te)};
+                indexSprites(te, scratch);
+                renderFrame(te);
+            }
         }
-    
-    private:
 
-        /** Returns the buffer part to be used for given column as the buffer is twice the column height. 
+        /** Builds the sprite index for the frame, i.e. the spans of the visible sprites that are at least partially on screen, ordered by their right edge. The index is allocated from the given scratch arena, which must outlive the rendering of the frame.
          */
-        ColorRGB * getRenderBufferChunk(Coord column, UITileEngine<TILE> const & te) {
-            return renderBuffer_ + (column & 1) * te.pixelHeight();
+        void indexSprites(UITileEngine<TILE> const & te, ScratchArena & scratch) {
+            uint32_t n = static_cast<uint32_t>(te.sprites_.size());
+            spans_ = scratch.alloc<SpriteSpan>(n);
+            active_ = scratch.alloc<SpriteSpan const *>(n);
+            numSpans_ = 0;
+            nextSpan_ = 0;
+            numActive_ = 0;
+            for (uint32_t i = 0; i != n; ++i) {
+                Sprite<typename TILE::Color> const * s = te.sprites_[i];
+                if (!s->visible() || s->y() >= te.pixelHeight() || s->y() + s->height() <= 0)
+                    continue;
+                Coord left = std::max(s->x(), 0);
+                Coord right = std::min(s->x() + s->width(), te.pixelWidth()) - 1;
+                if (left > right)
+                    continue;
+                spans_[numSpans_++] = SpriteSpan{s, left, right, s->z(), i};
+            }
+            std::sort(spans_, spans_ + numSpans_, [](SpriteSpan const & a, SpriteSpan const & b) {
+                return a.right > b.right;
+            });
         }
 
-        /** Renders the given column. 
+        /** Renders the given column into the buffer. The columns must be rendered from right to left after indexSprites() as the active sprites are updated along the way.
+
+            Exposed together with indexSprites() for testing the renderer without the display.
          */
-        void renderColumn(Coord column, UITileEngine<TILE> const & te) {
-            ColorRGB * rBuffer = getRenderBufferChunk(column, te);
+        void renderColumn(Coord column, ColorRGB * rBuffer, UITileEngine<TILE> const & te) {
             // get the tile x coordinate and the x coordinate within the tile
             int tx = column / TILE::Width;
             // get first tile info for the given column (the column is consecutive tiles), and iterate over the tiles
@@ -171,15 +187,64 @@ namespace rckid {
             ColorRGB * rb = rBuffer;
             for (int ty = 0; ty < te.h_; ++ty, ++tile)
                 rb = te.tiles_[static_cast<uint8_t>(tile->c)].renderColumn(column % TILE::Width, rb, te.palette(), tile->paletteOffset);
-            // render sprites & bitmaps, if any 
-            for (Sprite<typename TILE::Color> const * sprite : te.sprites_)
-                sprite->renderColumn(column, rBuffer, te.pixelHeight(), te.palette());
+            // activate sprites whose right edge has been reached, keeping the active sprites in z-order
+            while (nextSpan_ < numSpans_ && spans_[nextSpan_].right >= column) {
+                SpriteSpan const * span = spans_ + nextSpan_++;
+                uint32_t i = numActive_++;
+                for (; i > 0 && active_[i - 1]->drawnAfter(*span); --i)
+                    active_[i] = active_[i - 1];
+                active_[i] = span;
+            }
+            // render the active sprites, dropping those we are already past
+            uint32_t n = 0;
+            for (uint32_t i = 0; i < numActive_; ++i) {
+                SpriteSpan const * span = active_[i];
+                if (span->left > column)
+                    continue;
+                span->sprite->renderColumn(column, rBuffer, te.pixelHeight(), te.palette());
+                active_[n++] = span;
+            }
+            numActive_ = n;
+        }
+
+    private:
+
+        /** Horizontal span of a visible sprite on the screen. 
+         */
+        struct SpriteSpan {
+            Sprite<typename TILE::Color> const * sprite;
+            Coord left;
+            Coord right;
+            int z;
+            /** Order in which the sprite was added, which breaks the z-order ties. 
+             */
+            uint32_t index;
+
+            bool drawnAfter(SpriteSpan const & other) const {
+                return (z > other.z) || (z == other.z && index > other.index);
+            }
+        };
+
+        /** Number of bytes the sprite index of the engine needs in the scratch arena, including the alignment padding.
+         */
+        static uint32_t indexBytes(UITileEngine<TILE> const & te) {
+            uint32_t n = static_cast<uint32_t>(te.sprites_.size());
+            return n * (sizeof(SpriteSpan) + sizeof(SpriteSpan const *)) + alignof(SpriteSpan) + alignof(SpriteSpan const *);
+        }
 
+        void renderFrame(UITileEngine<TILE> const & te) {
+            pipeline_.render(0, te.pixelWidth(), te.pixelHeight(), [&](Coord column, ColorRGB * buffer) {
+                renderColumn(column, buffer, te);
+            });
         }
 
-        int column_;
-        // rendering buffer for 2 columns (double buffering single column)
-        ColorRGB * renderBuffer_ = nullptr;
+        RenderPipeline pipeline_;
+        // sprite spans for the current frame and the sprites overlapping the current column
+        SpriteSpan * spans_ = nullptr;
+        SpriteSpan const ** active_ = nullptr;
+        uint32_t numSpans_ = 0;
+        uint32_t nextSpan_ = 0;
+        uint32_t numActive_ = 0;
 
     }; // rckid::Renderer<UITileEngine>
 
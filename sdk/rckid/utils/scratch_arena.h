@@ -0,0 +1,115 @@
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../rckid.h"
+
+namespace rckid {
+
+    /** Scratch memory with bump allocation.
+
+        The scratch arena takes a single block of given size from the heap when created and then serves allocations simply by advancing a pointer in it. Nothing is ever freed individually, instead the whole arena, or everything allocated after a checkpoint, is released at once in O(1). The general heap and its free chunks are never touched after the block has been allocated, which makes the scratch arena ideal for temporaries that live for a single frame, such as line buffers, text layouts, or sorted sprite lists.
+
+        As no destructors are ever called, only trivially destructible objects can be created in the arena.
+
+        The App provides a scratch arena that is reset every frame, see App::frameScratch().
+     */
+    class ScratchArena {
+    public:
+
+        /** Checkpoint that releases everything allocated in the arena since its creation when destroyed.
+         */
+        class Scope {
+        public:
+            explicit Scope(ScratchArena & arena): arena_{arena}, mark_{arena.used_} {}
+            Scope(Scope const &) = delete;
+            ~Scope() { arena_.used_ = mark_; }
+        private:
+            ScratchArena & arena_;
+            uint32_t mark_;
+        }; // ScratchArena::Scope
+
+        explicit ScratchArena(uint32_t size):
+            buffer_{static_cast<uint8_t *>(rckid::malloc(size))},
+            size_{size} {
+        }
+
+        ScratchArena(ScratchArena const &) = delete;
+
+        ~ScratchArena() {
+            rckid::free(buffer_);
+        }
+
+        /** Size of the arena in bytes.
+         */
+        uint32_t size() const { return size_; }
+
+        /** Bytes currently allocated.
+         */
+        uint32_t used() const { return used_; }
+
+        /** Largest number of bytes allocated at the same time, useful for tuning the arena's size.
+         */
+        uint32_t peak() const { return peak_; }
+
+        /** Allocates given number of bytes with the specified alignment (which must be a power of two).
+         */
+        void * alloc(uint32_t numBytes, uint32_t alignment = 8) {
+            void * result = tryAlloc(numBytes, alignment);
+            ASSERT(result != nullptr);
+            return result;
+        }
+
+        /** Allocates given number of bytes with the specified alignment, or returns nullptr if they do not fit in the arena, so that the caller can fall back to the heap.
+         */
+        void * tryAlloc(uint32_t numBytes, uint32_t alignment = 8) {
+            uintptr_t addr = reinterpret_cast<uintptr_t>(buffer_) + used_;
+            uint32_t start = used_ + static_cast<uint32_t>(((addr + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - addr);
+            if (start + numBytes > size_)
+                return nullptr;
+            used_ = start + numBytes;
+            if (used_ > peak_)
+                peak_ = used_;
+            return buffer_ + start;
+        }
+
+        /** Allocates uninitialized array of count items of type T.
+         */
+        template<typename T>
+        T * alloc(uint32_t count) {
+            static_assert(std::is_trivially_destructible_v<T>, "scratch arena never calls destructors");
+            return static_cast<T *>(alloc(sizeof(T) * count, alignof(T)));
+        }
+
+        /** Allocates uninitialized array of count items of type T, or returns nullptr if it does not fit.
+         */
+        template<typename T>
+        T * tryAlloc(uint32_t count) {
+            static_assert(std::is_trivially_destructible_v<T>, "scratch arena never calls destructors");
+            return static_cast<T *>(tryAlloc(sizeof(T) * count, alignof(T)));
+        }
+
+        /** Creates single object of type T in the arena.
+         */
+        template<typename T, typename... ARGS>
+        T * create(ARGS &&... args) {
+            static_assert(std::is_trivially_destructible_v<T>, "scratch arena never calls destructors");
+            return new (alloc(sizeof(T), alignof(T))) T{std::forward<ARGS>(args)...};
+        }
+
+        /** Releases everything allocated in the arena.
+         */
+        void reset() { used_ = 0; }
+
+    private:
+
+        uint8_t * buffer_;
+        uint32_t size_;
+        uint32_t used_ = 0;
+        uint32_t peak_ = 0;
+
+    }; // rckid::ScratchArena
+
+} // namespace rckid
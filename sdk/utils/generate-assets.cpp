@@ -32,6 +32,12 @@
 
     Takes all files in the folder and onverts their raw contents into byte arrays. Creates fle NAMESPACE.h in the output folder and in it one definition per file in the folder. The actual byte array contents will be stored in separate files (`raw/NAMESPACE/filename.h`) and included where appropriate. 
 
+    ### Images
+
+        images, PATH_TO_FOLDER, NAMESPACE, BPP [, rle]
+
+    Converts all images in the folder into the native image format (see rckid::ImageAsset), which stores the pixels in the column-major layout used by surfaces, so that uncompressed images can be used straight from the ROM without any decoding or copying via Surface::fromAsset(). BPP is 16, 8 or 4, for the latter two the palette is generated from the image colors. If `rle` is specified, the pixels are RLE compressed when that saves space, in which case they have to be decompressed to RAM when loaded. Like with folders, the definitions are stored in NAMESPACE.h and the contents in `raw/NAMESPACE/filename.h`.
+
     ### Interpolation
 
         sine, FILENAME, N
@@ -81,6 +87,8 @@ int main(int argc, char * argv []) {
                     generateFontGlyphs(g, outputDir, nspace);
                 else if (g.name == "folder")
                     generateFolder(g, outputDir, nspace);
+                else if (g.name == "images")
+                    generateImages(g, outputDir, nspace);
                 else if (g.name == "sine")
                     generateSineTable(g, outputDir, nspace);
                 else 
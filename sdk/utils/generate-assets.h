@@ -292,6 +292,163 @@ void generateFolder(GeneratorSpecification const & g, std::string const & output
     hdr << "} // namespace " << nspace << "::" << outName << std::endl;
 }
 
+/** Compresses the pixel buffer with the run length encoding used by native image assets (see rckid::ImageAsset). Units are bytes, or 16bit words for 16bpp images. Runs of two or more identical units are stored as a run packet, everything else is grouped into literal packets of up to 128 units. 
+ */
+inline std::vector<uint8_t> compressRLE(std::vector<uint8_t> const & data, size_t unit) {
+    std::vector<uint8_t> result;
+    size_t n = data.size() / unit;
+    auto same = [&](size_t a, size_t b) { return std::equal(data.begin() + a * unit, data.begin() + (a + 1) * unit, data.begin() + b * unit); };
+    size_t i = 0;
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < 128 && same(i, i + run))
+            ++run;
+        if (run >= 2) {
+            result.push_back(static_cast<uint8_t>(0x80 | (run - 1)));
+            result.insert(result.end(), data.begin() + i * unit, data.begin() + (i + 1) * unit);
+            i += run;
+        } else {
+            size_t start = i++;
+            while (i < n && i - start < 128 && (i + 1 >= n || !same(i, i + 1)))
+                ++i;
+            result.push_back(static_cast<uint8_t>(i - start - 1));
+            result.insert(result.end(), data.begin() + start * unit, data.begin() + i * unit);
+        }
+    }
+    return result;
+}
+
+/** Converts the given image to the native image asset format (see rckid::ImageAsset) and outputs it as a contents of C++ array of uint8_t to the given output stream. Returns the size of the asset in bytes. 
+ 
+    The pixels are stored in the column-major layout used by surfaces so that they can be used without any decoding. For 8 and 4 bpp the palette is built from the colors used by the image. Palette index 0 is reserved for fully transparent pixels as sprites and tiles do not draw it, so the image must have at least one color less than the bit depth allows. Partially transparent pixels, and for 16 bpp all transparent pixels, are blended over black. 
+ */
+inline size_t generateImageContent(std::filesystem::path const & inputFile, int bpp, bool rle, std::ostream & out) {
+    if (bpp != 16 && bpp != 8 && bpp != 4)
+        throw std::runtime_error(STR("Invalid bpp " << bpp << ", only 16, 8 and 4 are supported"));
+    Image img = LoadImage(inputFile.string().c_str());
+    if (img.data == nullptr)
+        throw std::runtime_error(STR("Cannot load image " << inputFile));
+    if (bpp == 4 && img.height % 2 != 0)
+        throw std::runtime_error(STR("Image " << inputFile << " must have even height for 4 bpp"));
+    // get the pixel values (colors or palette indices) in the native order, i.e. columns right to left, top to bottom
+    std::vector<uint16_t> palette;
+    if (bpp != 16)
+        palette.push_back(0);
+    std::vector<uint16_t> values;
+    for (int x = img.width - 1; x >= 0; --x) {
+        for (int y = 0; y < img.height; ++y) {
+            Color c = GetImageColor(img, x, y);
+            unsigned r = c.r * c.a / 255;
+            unsigned g = c.g * c.a / 255;
+            unsigned b = c.b * c.a / 255;
+            uint16_t rgb = static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+            if (bpp == 16) {
+                values.push_back(rgb);
+                continue;
+            }
+            if (c.a == 0) {
+                values.push_back(0);
+                continue;
+            }
+            auto i = std::find(palette.begin() + 1, palette.end(), rgb);
+            if (i == palette.end()) {
+                if (palette.size() == (1u << bpp))
+                    throw std::runtime_error(STR("Image " << inputFile << " has more than " << ((1 << bpp) - 1) << " opaque colors"));
+                i = palette.insert(palette.end(), rgb);
+            }
+            values.push_back(static_cast<uint16_t>(i - palette.begin()));
+        }
+    }
+    int width = img.width;
+    int height = img.height;
+    UnloadImage(img);
+    // pack the values into the pixel buffer
+    std::vector<uint8_t> pixels;
+    for (size_t i = 0; i < values.size(); ++i) {
+        switch (bpp) {
+            case 16:
+                pixels.push_back(values[i] & 0xff);
+                pixels.push_back(values[i] >> 8);
+                break;
+            case 8:
+                pixels.push_back(static_cast<uint8_t>(values[i]));
+                break;
+            case 4:
+                // even pixels are stored in the lower nibble
+                if (i % 2 == 0)
+                    pixels.push_back(static_cast<uint8_t>(values[i]));
+                else
+                    pixels.back() |= static_cast<uint8_t>(values[i] << 4);
+                break;
+        }
+    }
+    if (rle) {
+        std::vector<uint8_t> compressed = compressRLE(pixels, (bpp == 16) ? 2 : 1);
+        // no point in compressing if it does not save anything, keeps the image usable without a copy
+        if (compressed.size() < pixels.size())
+            pixels = std::move(compressed);
+        else
+            rle = false;
+    }
+    // pad the palette to an even number of colors so that the pixel data after the 8 byte header stays 4 byte aligned
+    if (palette.size() % 2 != 0)
+        palette.push_back(0);
+    std::vector<uint8_t> bytes{
+        static_cast<uint8_t>(width & 0xff), static_cast<uint8_t>(width >> 8),
+        static_cast<uint8_t>(height & 0xff), static_cast<uint8_t>(height >> 8),
+        static_cast<uint8_t>(bpp), static_cast<uint8_t>(rle ? 1 : 0),
+        static_cast<uint8_t>(palette.size() & 0xff), static_cast<uint8_t>(palette.size() >> 8),
+    };
+    for (uint16_t c : palette) {
+        bytes.push_back(c & 0xff);
+        bytes.push_back(c >> 8);
+    }
+    bytes.insert(bytes.end(), pixels.begin(), pixels.end());
+    out << "// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets" << std::endl;
+    out << "// Input file: " << inputFile << std::endl;
+    out << "// Image:      " << width << "x" << height << ", " << bpp << " bpp, " << palette.size() << " palette colors" << (rle ? ", RLE" : "") << std::endl;
+    out << "// Size:       " << bytes.size() << " bytes" << std::endl;
+    size_t i = 0; 
+    for (uint8_t x : bytes) {
+        out << static_cast<unsigned>(x) << ",";
+        if (++i % 16 == 0)
+            out << std::endl;
+    }
+    return bytes.size();
+}
+
+/** Converts all images in the specified folder into native image assets (see rckid::ImageAsset) in given namespace. Like with the folder generator, each image is a static constexpr array in the namespace header and its contents are stored in a separate header file that is included. 
+ */
+void generateImages(GeneratorSpecification const & g, std::string const & outputDir, std::string const & nspace) {
+    if (g.args.size() < 3 || g.args.size() > 4 || (g.args.size() == 4 && g.args[3] != "rle"))
+        throw std::runtime_error("Invalid number or arguments, usage: images, PATH, namespace, BPP [, rle]");
+    namespace fs = std::filesystem;
+    std::string folder = g.args[0];
+    std::string outName = g.args[1];
+    int bpp = std::atoi(g.args[2].c_str());
+    bool rle = g.args.size() == 4;
+    fs::create_directories(STR(outputDir << "/raw/" << outName));
+    std::ofstream hdr(STR(outputDir << "/" << outName << ".h"));
+    hdr << "#pragma once" << std::endl << std::endl;
+    hdr << "// DO NOT EDIT THIS FILE, IT HAS BEEN AUTOGENERATED BY generate-assets" << std::endl << std::endl;
+    hdr << "#include \"../rckid.h\"" << std::endl << std::endl;
+    hdr << "// Folder: " << folder << ", " << bpp << " bpp" << (rle ? ", RLE" : "") << std::endl;
+    hdr << "namespace " << nspace << "::" << outName << "{" << std::endl;
+    for (auto const & entry : fs::directory_iterator{folder}) {
+        std::string name = convertToClassName(entry.path().stem());
+        std::string outputFile = STR(outputDir << "/raw/" << outName << "/" << entry.path().stem().c_str() << ".h");
+        std::ofstream outputStream(outputFile);
+        size_t numBytes = generateImageContent(entry.path(), bpp, rle, outputStream);
+        hdr << std::endl;
+        hdr << "    // File: " << entry.path().filename().c_str() << std::endl;
+        hdr << "    // Size: " << numBytes << std::endl;
+        hdr << "    alignas(4) static constexpr uint8_t " << name << "[] = {" << std::endl;
+        hdr << "        #include \"raw/" << outName << "/" << entry.path().stem().c_str() << ".h\"" << std::endl;
+        hdr << "    };" << std::endl;
+    }
+    hdr << "} // namespace " << nspace << "::" << outName << std::endl;
+}
+
 /** Very simple generator of sine tables for quick interolation. 
  
     Note that the generator only creates the sine table contents itself and must be linked with the appropriate array (we do not expect to have very many of these)
@@ -0,0 +1,87 @@
+#include <vector>
+
+#include <platform/tests.h>
+#include <rckid/internals.h>
+#include <rckid/graphics/bitmap.h>
+
+using namespace rckid;
+
+namespace {
+
+    struct CapturedPixel {
+        Coord x;
+        Coord y;
+        ColorRGB color;
+    };
+
+    /** Renders the bitmap with the doubled renderer and returns the physical display pixels in the order they were sent.
+     */
+    template<typename GRAPHICS>
+    std::vector<CapturedPixel> captureRender(Renderer<Doubled<GRAPHICS>> & r, Doubled<GRAPHICS> const & b) {
+        std::vector<CapturedPixel> result;
+        displayCapture([&](Coord x, Coord y, ColorRGB const & c) { result.push_back(CapturedPixel{x, y, c}); });
+        r.render(b);
+        displayWaitUpdateDone();
+        displayCapture(nullptr);
+        return result;
+    }
+
+    /** Checks that the captured pixels are the given bitmap rectangle, each pixel doubled in both directions, sent column by column from the right in physical coordinates of the doubled display update region.
+     */
+    template<typename GRAPHICS>
+    bool checkDoubled(std::vector<CapturedPixel> const & pixels, Doubled<GRAPHICS> const & b, Rect region, Rect rect) {
+        if (pixels.size() != static_cast<size_t>(rect.w * rect.h * 4))
+            return false;
+        Coord columnHeight = rect.h * 2;
+        for (size_t i = 0; i < pixels.size(); ++i) {
+            Coord x = (region.x + rect.right()) * 2 - 1 - static_cast<Coord>(i) / columnHeight;
+            Coord y = (region.y + rect.y) * 2 + static_cast<Coord>(i) % columnHeight;
+            if (pixels[i].x != x || pixels[i].y != y)
+                return false;
+            if (pixels[i].color != b.pixelAt(x / 2 - region.x, y / 2 - region.y))
+                return false;
+        }
+        return true;
+    }
+
+}
+
+TEST(doubled, renderFull) {
+    memoryEnterArena();
+    Doubled<Bitmap<ColorRGB>> b{40, 30};
+    for (Coord x = 0; x < 40; ++x)
+        for (Coord y = 0; y < 30; ++y)
+            b.setPixelAt(x, y, ColorRGB::fromRaw(static_cast<uint16_t>(x * 31 + y * 7)));
+    Renderer<Doubled<Bitmap<ColorRGB>>> r;
+    r.initialize(b);
+    // the update region is centered in the 160x120 doubled coordinates
+    Rect region = displayUpdateRegion();
+    EXPECT(region.x == 60 && region.y == 45 && region.w == 40 && region.h == 30);
+    std::vector<CapturedPixel> pixels = captureRender(r, b);
+    EXPECT(checkDoubled(pixels, b, region, Rect::WH(40, 30)));
+    // nothing is sent when the bitmap has not changed
+    EXPECT(captureRender(r, b).empty());
+    r.finalize();
+    displaySetMode(DisplayMode::Native);
+    memoryLeaveArena();
+}
+
+TEST(doubled, renderDirty) {
+    memoryEnterArena();
+    Doubled<Bitmap<ColorRGB>> b{40, 30};
+    b.fill(color::Black);
+    Renderer<Doubled<Bitmap<ColorRGB>>> r;
+    r.initialize(b);
+    Rect region = displayUpdateRegion();
+    captureRender(r, b);
+    b.setPixelAt(7, 3, color::White);
+    b.setPixelAt(9, 4, color::Red);
+    std::vector<CapturedPixel> pixels = captureRender(r, b);
+    // only the dirty 3x2 part is sent, still doubled and at its place on the screen
+    EXPECT(checkDoubled(pixels, b, region, Rect::XYWH(7, 3, 3, 2)));
+    EXPECT(pixels.front().x == (60 + 9) * 2 + 1);
+    EXPECT(pixels.front().y == (45 + 3) * 2);
+    r.finalize();
+    displaySetMode(DisplayMode::Native);
+    memoryLeaveArena();
+}
@@ -0,0 +1,96 @@
+#include <cstring>
+
+#include <platform/tests.h>
+#include <rckid/graphics/bitmap.h>
+#include <rckid/assets/fonts/Iosevka16.h>
+#include <rckid/assets/fonts/OpenDyslexic64.h>
+
+using namespace rckid;
+
+namespace {
+    Font const font = Font::fromROM<assets::font::Iosevka16>();
+
+    /** Returns the 0..3 color index of the glyph's pixel straight from the packed font data.
+     */
+    uint8_t packedPixel(Font const & font, GlyphInfo const & g, int x, int y) {
+        // each column starts at a new word and holds 16 pixels per word
+        uint32_t wordsPerColumn = (g.height + 15) / 16;
+        uint32_t word = font.pixels[g.index + x * wordsPerColumn + y / 16];
+        return (word >> (30 - (y % 16) * 2)) & 0x3;
+    }
+}
+
+TEST(glyphCache, hits) {
+    memoryEnterArena();
+    GlyphCache cache{2};
+    uint8_t const * a = cache.get(font, font.glyphInfoFor('A'));
+    EXPECT(cache.misses() == 1);
+    EXPECT(cache.hits() == 0);
+    // cached glyph is returned as is
+    EXPECT(cache.get(font, font.glyphInfoFor('A')) == a);
+    cache.get(font, font.glyphInfoFor('B'));
+    EXPECT(cache.get(font, font.glyphInfoFor('A')) == a);
+    EXPECT(cache.misses() == 2);
+    EXPECT(cache.hits() == 2);
+    memoryLeaveArena();
+}
+
+TEST(glyphCache, evictsLeastRecentlyUsed) {
+    memoryEnterArena();
+    GlyphCache cache{2};
+    cache.get(font, font.glyphInfoFor('A'));
+    cache.get(font, font.glyphInfoFor('B'));
+    // A is used more recently than B, so C replaces B
+    cache.get(font, font.glyphInfoFor('A'));
+    cache.get(font, font.glyphInfoFor('C'));
+    EXPECT(cache.misses() == 3);
+    cache.get(font, font.glyphInfoFor('A'));
+    cache.get(font, font.glyphInfoFor('C'));
+    EXPECT(cache.misses() == 3);
+    EXPECT(cache.hits() == 3);
+    cache.get(font, font.glyphInfoFor('B'));
+    EXPECT(cache.misses() == 4);
+    // clearing the cache evicts everything
+    cache.clear();
+    cache.get(font, font.glyphInfoFor('A'));
+    EXPECT(cache.misses() == 5);
+    memoryLeaveArena();
+}
+
+TEST(glyphCache, pixelsMatchFont) {
+    memoryEnterArena();
+    GlyphCache cache{4};
+    for (Font const & f : { font, assets::font::OpenDyslexic64::font }) {
+        for (char c : { 'A', 'g', 'W', '@', '.' }) {
+            GlyphInfo const & g = f.glyphInfoFor(c);
+            uint8_t const * pixels = cache.get(f, g);
+            bool same = true;
+            for (int x = 0; x < g.width; ++x)
+                for (int y = 0; y < g.height; ++y)
+                    same = same && (pixels[x * g.height + y] == packedPixel(f, g, x, y));
+            EXPECT(same);
+        }
+    }
+    memoryLeaveArena();
+}
+
+TEST(glyphCache, renderingMatchesUncached) {
+    memoryEnterArena();
+    GlyphCache cache{1};
+    Surface<ColorRGB> cached{64, 32};
+    Surface<ColorRGB> uncached{64, 32};
+    // the same cached glyph is drawn in different colors
+    ColorRGB white[] = { color::Black, color::White, color::White, color::White };
+    ColorRGB red[] = { color::Black, color::Red, color::Red, color::Red };
+    for (ColorRGB const * colors : { white, red, white }) {
+        cached.fill(color::Blue);
+        uncached.fill(color::Blue);
+        cached.text(-3, 20, font, colors, & cache) << "AAAAAAAAA";
+        uncached.text(-3, 20, font, colors) << "AAAAAAAAA";
+        EXPECT(memcmp(cached.buffer(), uncached.buffer(), pixelBufferSize<ColorRGB>(64, 32)) == 0);
+    }
+    // the single glyph is only unpacked once
+    EXPECT(cache.misses() == 1);
+    EXPECT(cache.hits() > 0);
+    memoryLeaveArena();
+}
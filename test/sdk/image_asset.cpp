@@ -0,0 +1,105 @@
+#include <utility>
+
+#include <platform/tests.h>
+#include <rckid/graphics/bitmap.h>
+#include <rckid/graphics/png.h>
+#include <rckid/assets/icons.h>
+#include <rckid/assets/icons_native.h>
+
+using namespace rckid;
+
+namespace {
+
+    // 2x4 RGB image, columns stored right to left
+    alignas(4) constexpr uint8_t rgbImage[] = {
+        2, 0, 4, 0, 16, 0, 0, 0,
+        0x00, 0xf8, 0xe0, 0x07, 0x1f, 0x00, 0xff, 0xff, // x = 1
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // x = 0
+    };
+
+    // 4x4 RLE compressed image with 3 palette colors, padded to 4
+    alignas(4) constexpr uint8_t rleImage[] = {
+        4, 0, 4, 0, 4, 0b1, 4, 0,
+        0x00, 0x00, 0x00, 0xf8, 0xe0, 0x07, 0x00, 0x00,
+        0x81, 0x10,             // run of 2 bytes (x = 3)
+        0x00, 0x21,             // literal of 1 byte (x = 2, y = 0 and 1)
+        0x80, 0x00,             // run of 1 byte (x = 2, y = 2 and 3)
+        0x83, 0x22,             // run of 4 bytes (x = 1 and 0)
+    };
+}
+
+TEST(imageAsset, header) {
+    ImageAsset a{rgbImage};
+    EXPECT(a.width() == 2);
+    EXPECT(a.height() == 4);
+    EXPECT(a.bpp() == 16);
+    EXPECT(a.compressed() == false);
+    EXPECT(a.palette() == nullptr);
+    ImageAsset b{rleImage};
+    EXPECT(b.width() == 4);
+    EXPECT(b.bpp() == 4);
+    EXPECT(b.compressed());
+    EXPECT(b.paletteSize() == 4);
+    // the padded palette keeps the pixel data aligned
+    EXPECT(reinterpret_cast<uintptr_t>(b.pixels()) % 4 == 0);
+    EXPECT(b.palette()[1] == ColorRGB{255, 0, 0});
+}
+
+TEST(imageAsset, zeroCopy) {
+    memoryEnterArena();
+    uint32_t used = memoryUsedHeap();
+    {
+        Surface<ColorRGB> s = Surface<ColorRGB>::fromAsset(ImageAsset{rgbImage});
+        EXPECT(memoryUsedHeap() == used);
+        EXPECT(s.ownsBuffer() == false);
+        EXPECT(std::as_const(s).buffer() == rgbImage + ImageAsset::HEADER_SIZE);
+        EXPECT(s.pixelAt(1, 0) == ColorRGB{255, 0, 0});
+        EXPECT(s.pixelAt(1, 1) == ColorRGB{0, 255, 0});
+        EXPECT(s.pixelAt(1, 2) == ColorRGB{0, 0, 255});
+        EXPECT(s.pixelAt(0, 3) == ColorRGB{0, 0, 0});
+        Surface<ColorRGB> target{4, 4};
+        target.fill(color::White);
+        target.blit(Point{1, 0}, s);
+        EXPECT(target.pixelAt(2, 1) == ColorRGB{0, 255, 0});
+        EXPECT(target.pixelAt(1, 1) == ColorRGB{0, 0, 0});
+    }
+    memoryLeaveArena();
+}
+
+TEST(imageAsset, rle) {
+    memoryEnterArena();
+    Bitmap<Color16> b = Bitmap<Color16>::fromAsset(ImageAsset{rleImage});
+    EXPECT(b.ownsBuffer());
+    EXPECT(b.palette() == ImageAsset{rleImage}.palette());
+    uint8_t expected[4][4] = {
+        { 2, 2, 2, 2 },
+        { 2, 2, 2, 2 },
+        { 1, 2, 0, 0 },
+        { 0, 1, 0, 1 },
+    };
+    for (int x = 0; x < 4; ++x)
+        for (int y = 0; y < 4; ++y)
+            EXPECT(b.pixelAt(x, y).toRaw() == expected[x][y]);
+    memoryLeaveArena();
+}
+
+TEST(imageAsset, nativeIcon) {
+    memoryEnterArena();
+    ImageAsset a{assets::icons_native::game_controller};
+    EXPECT(a.width() == 64);
+    EXPECT(a.height() == 64);
+    EXPECT(a.bpp() == 16);
+    EXPECT(a.compressed() == false);
+    uint32_t used = memoryUsedHeap();
+    Surface<ColorRGB> s = Surface<ColorRGB>::fromAsset(a);
+    EXPECT(memoryUsedHeap() == used);
+    // transparent pixels are blended differently, but the opaque ones must be the same as the PNG's
+    bool same = true;
+    PNG::fromBuffer(assets::icons::game_controller).decode([&](ColorRGB * line, uint8_t const * alpha, int lineNum, int lineWidth) {
+        for (int i = 0; i < lineWidth; ++i)
+            if (alpha == nullptr || alpha[i] == 255)
+                same = same && (s.pixelAt(i, lineNum) == line[i]);
+    });
+    EXPECT(same);
+    memoryLeaveArena();
+}
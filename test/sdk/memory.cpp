@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include <platform/tests.h>
 #include <rckid/rckid.h>
 
@@ -13,11 +15,12 @@ TEST(memory, arenaFree) {
     uint32_t freeHeap = rckid::memoryFreeHeap();
     rckid::memoryEnterArena();
     uint32_t afterArena = rckid::memoryFreeHeap();
-    EXPECT(freeHeap - sizeof(void*) *2 == afterArena);
+    // the arena header with its size class bins
+    EXPECT(afterArena < freeHeap);
     rckid::malloc(128);
     uint32_t afterAlloc = rckid::memoryFreeHeap();
-    // the 128bytes + 4 bytes chunk header 
-    EXPECT(afterArena - 128 - 4 == afterAlloc);
+    // the 128bytes + 4 bytes chunk header, rounded up to keep the next chunk 8 byte aligned
+    EXPECT(afterArena - 128 - 8 == afterAlloc);
     rckid::memoryLeaveArena();
     // everything gets deleted when done
     EXPECT(freeHeap == rckid::memoryFreeHeap());
@@ -27,7 +30,7 @@ TEST(memory, immediateDeleteDeallocates) {
     rckid::memoryEnterArena();
     uint32_t freeHeap = rckid::memoryFreeHeap();
     void * ptr = rckid::malloc(128);
-    EXPECT(rckid::memoryFreeHeap() + 128 + 4 == freeHeap);
+    EXPECT(rckid::memoryFreeHeap() + 128 + 8 == freeHeap);
     rckid::free(ptr);
     EXPECT(rckid::memoryFreeHeap() == freeHeap);
     rckid::memoryLeaveArena();
@@ -38,10 +41,29 @@ TEST(memory, nonImmediateDeleteDoesNotDeallocate) {
     uint32_t freeHeap = rckid::memoryFreeHeap();
     void * ptr1 = rckid::malloc(128);
     void * ptr2 = rckid::malloc(128);
-    EXPECT(rckid::memoryFreeHeap() + (128 + 4) * 2 == freeHeap);
+    EXPECT(rckid::memoryFreeHeap() + (128 + 8) * 2 == freeHeap);
     rckid::free(ptr1);
+    EXPECT(rckid::memoryFreeHeap() + (128 + 8) * 2 == freeHeap);
     rckid::free(ptr2);
-    EXPECT(rckid::memoryFreeHeap() != freeHeap);
+    // freeing the top chunk reclaims the free chunk below it as well
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, adjacentFreeChunksCoalesce) {
+    rckid::memoryEnterArena();
+    void * a = rckid::malloc(128);
+    void * b = rckid::malloc(128);
+    void * c = rckid::malloc(128);
+    void * guard = rckid::malloc(128);
+    uint32_t freeHeap = rckid::memoryFreeHeap();
+    rckid::free(a);
+    rckid::free(c);
+    rckid::free(b);
+    // the three chunks are merged into one that fits the whole allocation
+    EXPECT(rckid::malloc(128 * 3 + 8 * 2) == a);
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    rckid::free(guard);
     rckid::memoryLeaveArena();
 }
 
@@ -57,3 +79,132 @@ TEST(memory, freeAndUsedCountersMatch) {
     EXPECT(totalMem = rckid::memoryFreeHeap() + rckid::memoryUsedHeap());
 }
 
+TEST(memory, exactFitReuse) {
+    rckid::memoryEnterArena();
+    void * small = rckid::malloc(16);
+    void * guard1 = rckid::malloc(16);
+    void * large = rckid::malloc(1024);
+    void * guard2 = rckid::malloc(16);
+    rckid::free(large);
+    rckid::free(small);
+    // the small chunk fits exactly and must be preferred to splitting the large one
+    EXPECT(rckid::malloc(16) == small);
+    EXPECT(rckid::malloc(1024) == large);
+    rckid::free(guard1);
+    rckid::free(guard2);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, oversizedChunkIsSplit) {
+    rckid::memoryEnterArena();
+    void * large = rckid::malloc(1024);
+    void * guard = rckid::malloc(16);
+    uint32_t freeHeap = rckid::memoryFreeHeap();
+    rckid::free(large);
+    void * a = rckid::malloc(32);
+    void * b = rckid::malloc(32);
+    // both small allocations are served from the freed large chunk without touching the heap end
+    EXPECT(a == large);
+    EXPECT(b == static_cast<char*>(large) + 32 + 8);
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    rckid::free(guard);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, alignment) {
+    rckid::memoryEnterArena();
+    for (size_t i = 0; i < 64; ++i)
+        EXPECT(reinterpret_cast<uintptr_t>(rckid::malloc(i)) % 8 == 0);
+    void * ptr = rckid::mallocAligned(100, 256);
+    EXPECT(reinterpret_cast<uintptr_t>(ptr) % 256 == 0);
+    rckid::free(ptr);
+    EXPECT(reinterpret_cast<uintptr_t>(rckid::malloc(10)) % 8 == 0);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, calloc) {
+    rckid::memoryEnterArena();
+    uint8_t * ptr = static_cast<uint8_t*>(rckid::malloc(64));
+    memset(ptr, 0xff, 64);
+    rckid::free(ptr);
+    uint8_t * zeroed = static_cast<uint8_t*>(rckid::calloc(16, 4));
+    EXPECT(zeroed == ptr);
+    for (size_t i = 0; i < 64; ++i)
+        EXPECT(zeroed[i] == 0);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, reallocLastChunkInPlace) {
+    rckid::memoryEnterArena();
+    uint32_t freeHeap = rckid::memoryFreeHeap();
+    char * ptr = static_cast<char*>(rckid::malloc(128));
+    ptr[0] = 42;
+    EXPECT(rckid::realloc(ptr, 1024) == ptr);
+    EXPECT(rckid::memoryFreeHeap() + 1024 + 8 == freeHeap);
+    EXPECT(ptr[0] == 42);
+    EXPECT(rckid::realloc(ptr, 128) == ptr);
+    EXPECT(rckid::memoryFreeHeap() + 128 + 8 == freeHeap);
+    rckid::free(ptr);
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, reallocIntoFreeNeighbour) {
+    rckid::memoryEnterArena();
+    char * ptr = static_cast<char*>(rckid::malloc(128));
+    void * next = rckid::malloc(256);
+    void * guard = rckid::malloc(16);
+    ptr[127] = 42;
+    rckid::free(next);
+    EXPECT(rckid::realloc(ptr, 256) == ptr);
+    EXPECT(ptr[127] == 42);
+    // the rest of the neighbour is still available
+    EXPECT(rckid::malloc(64) == ptr + 256 + 8);
+    rckid::free(guard);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, reallocCopies) {
+    rckid::memoryEnterArena();
+    char * ptr = static_cast<char*>(rckid::malloc(128));
+    void * guard = rckid::malloc(16);
+    for (int i = 0; i < 128; ++i)
+        ptr[i] = static_cast<char>(i);
+    char * moved = static_cast<char*>(rckid::realloc(ptr, 512));
+    EXPECT(moved != ptr);
+    for (int i = 0; i < 128; ++i)
+        EXPECT(moved[i] == static_cast<char>(i));
+    // the old chunk is free again
+    EXPECT(rckid::malloc(128) == ptr);
+    rckid::free(guard);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, callCounters) {
+    uint32_t mallocs = rckid::memoryMallocCalls();
+    uint32_t frees = rckid::memoryFreeCalls();
+    rckid::memoryEnterArena();
+    rckid::free(rckid::malloc(16));
+    rckid::free(rckid::malloc(16));
+    EXPECT(rckid::memoryMallocCalls() == mallocs + 2);
+    EXPECT(rckid::memoryFreeCalls() == frees + 2);
+    rckid::memoryLeaveArena();
+}
+
+TEST(memory, fragmentation) {
+    rckid::memoryEnterArena();
+    rckid::MemoryFragmentation f = rckid::memoryFragmentation();
+    EXPECT(f.freeChunks == 0);
+    EXPECT(f.freeBytes == rckid::memoryFreeHeap());
+    EXPECT(f.percent() == 0);
+    void * a = rckid::malloc(1020);
+    void * guard = rckid::malloc(16);
+    rckid::free(a);
+    f = rckid::memoryFragmentation();
+    EXPECT(f.freeChunks == 1);
+    EXPECT(f.freeBytes == rckid::memoryFreeHeap() + 1020);
+    EXPECT(f.largestFreeBlock == rckid::memoryFreeHeap());
+    rckid::free(guard);
+    EXPECT(rckid::memoryFragmentation().freeChunks == 0);
+    rckid::memoryLeaveArena();
+}
@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include <platform/tests.h>
+#include <rckid/rckid.h>
+
+/** Allocator benchmark & stress tests.
+
+    Replays allocation traces modelled after typical workloads (menu navigation, PNG loading, a Tetris session and a comms session) against the rckid heap. Each trace is a sequence of allocations and frees of numbered slots, generated deterministically so that the numbers are comparable between allocator changes. Every trace is built once and first replayed with timing only, against both the rckid heap and the host's malloc for reference, then again against the rckid heap with measurements of the peak heap, worst fragmentation and the first operation that would not fit into the trace's heap budget. The results are written to the standard output.
+
+    The traces are synthetic, i.e. generated from a rough model of each workload's allocations rather than recorded on the device. The numbers are good for comparing allocator changes, but do not describe the real workloads. To replay a recorded trace instead, simply fill the Trace with the recorded operations.
+ */
+namespace {
+
+    struct TraceOp {
+        uint32_t slot;
+        /** Number of bytes to allocate, or 0 to free the slot.
+         */
+        uint32_t size;
+    };
+
+    class Trace {
+    public:
+        char const * name;
+        /** Heap available to the trace, anything above is blocked before the trace is replayed.
+         */
+        uint32_t budget;
+        std::vector<TraceOp> ops;
+        uint32_t numSlots = 0;
+
+        Trace(char const * name, uint32_t budget): name{name}, budget{budget} {}
+
+        uint32_t alloc(uint32_t size) {
+            uint32_t slot;
+            if (freeSlots_.empty()) {
+                slot = numSlots++;
+            } else {
+                slot = freeSlots_.back();
+                freeSlots_.pop_back();
+            }
+            ops.push_back(TraceOp{slot, size});
+            return slot;
+        }
+
+        void free(uint32_t slot) {
+            ops.push_back(TraceOp{slot, 0});
+            freeSlots_.push_back(slot);
+        }
+
+    private:
+        std::vector<uint32_t> freeSlots_;
+    };
+
+    /** Deterministic xorshift generator so that traces are identical between runs.
+     */
+    class TraceRandom {
+    public:
+        uint32_t next() {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 17;
+            state_ ^= state_ << 5;
+            return state_;
+        }
+        uint32_t next(uint32_t min, uint32_t max) { return min + next() % (max - min + 1); }
+    private:
+        uint32_t state_ = 0x12345678;
+    };
+
+    /** Menu navigation: menus of strings and callbacks are created and destroyed as the user moves between them, with icons loaded for the visible items.
+     */
+    Trace menuNavigation() {
+        Trace t{"menuNavigation", 128 * 1024};
+        TraceRandom r;
+        for (int menu = 0; menu < 500; ++menu) {
+            std::vector<uint32_t> items;
+            uint32_t numItems = r.next(4, 20);
+            for (uint32_t i = 0; i < numItems; ++i) {
+                items.push_back(t.alloc(r.next(8, 40)));  // title
+                items.push_back(t.alloc(32));             // std::function
+            }
+            std::vector<uint32_t> icons;
+            for (int i = 0; i < 3; ++i)
+                icons.push_back(t.alloc(64 * 64 * 2 + 8));
+            // moving in the carousel reloads the icons
+            for (int step = 0, e = r.next(1, 10); step < e; ++step) {
+                uint32_t i = r.next(0, 2);
+                t.free(icons[i]);
+                icons[i] = t.alloc(64 * 64 * 2 + 8);
+                uint32_t s = t.alloc(r.next(4, 24)); // formatted text
+                t.free(s);
+            }
+            for (uint32_t i : icons)
+                t.free(i);
+            for (uint32_t i : items)
+                t.free(i);
+        }
+        return t;
+    }
+
+    /** PNG loading: the decoder's state, line buffers and the resulting bitmaps, some of which are kept while others are loaded.
+     */
+    Trace pngLoad() {
+        Trace t{"pngLoad", 400 * 1024};
+        TraceRandom r;
+        std::vector<uint32_t> kept;
+        for (int image = 0; image < 100; ++image) {
+            uint32_t w = r.next(16, 320);
+            uint32_t h = r.next(16, 240);
+            uint32_t decoder = t.alloc(46 * 1024);
+            uint32_t bitmap = t.alloc(w * h * 2);
+            for (uint32_t line = 0; line < h; line += 16) {
+                uint32_t buffer = t.alloc(w * 2);
+                t.free(buffer);
+            }
+            t.free(decoder);
+            kept.push_back(bitmap);
+            if (kept.size() > 2) {
+                uint32_t i = r.next(0, static_cast<uint32_t>(kept.size() - 1));
+                t.free(kept[i]);
+                kept.erase(kept.begin() + i);
+            }
+        }
+        for (uint32_t i : kept)
+            t.free(i);
+        return t;
+    }
+
+    /** Tetris session: the game state is allocated once, then every frame formats the score and level strings.
+     */
+    Trace tetrisSession() {
+        Trace t{"tetrisSession", 96 * 1024};
+        TraceRandom r;
+        uint32_t board = t.alloc(10 * 20);
+        uint32_t framebuffer = t.alloc(320 * 240);
+        uint32_t nextPiece = t.alloc(16);
+        for (int frame = 0; frame < 20000; ++frame) {
+            uint32_t score = t.alloc(r.next(2, 16));
+            uint32_t level = t.alloc(r.next(2, 8));
+            t.free(score);
+            t.free(level);
+            if (frame % 60 == 0) {
+                t.free(nextPiece);
+                nextPiece = t.alloc(16);
+            }
+        }
+        t.free(nextPiece);
+        t.free(framebuffer);
+        t.free(board);
+        return t;
+    }
+
+    /** Comms session: connections with their ring buffers come and go, while messages and ack callbacks are allocated for every packet.
+     */
+    Trace commsSession() {
+        Trace t{"commsSession", 64 * 1024};
+        TraceRandom r;
+        std::vector<uint32_t> connections;
+        for (int packet = 0; packet < 20000; ++packet) {
+            if (connections.empty() || (connections.size() < 8 && r.next(0, 100) == 0))
+                connections.push_back(t.alloc(1064));
+            else if (connections.size() > 1 && r.next(0, 200) == 0) {
+                uint32_t i = r.next(0, static_cast<uint32_t>(connections.size() - 1));
+                t.free(connections[i]);
+                connections.erase(connections.begin() + i);
+            }
+            uint32_t callback = t.alloc(32);
+            uint32_t payload = t.alloc(r.next(1, 32));
+            t.free(payload);
+            t.free(callback);
+        }
+        for (uint32_t i : connections)
+            t.free(i);
+        return t;
+    }
+
+    struct TraceResult {
+        double nsPerOp = 0;
+        /** Time per operation of the host's malloc & free for the same trace.
+         */
+        double hostNsPerOp = 0;
+        uint32_t peakHeap = 0;
+        uint32_t worstFragmentation = 0;
+        /** Index of the first operation that did not fit in the budget, or the number of operations if all fit.
+         */
+        size_t failedAt = 0;
+        bool leaked = false;
+    };
+
+    /** Returns true if allocation of given size can succeed. Only walks the free chunks when the heap end does not have enough space, so that the check is cheap most of the time.
+     */
+    bool fits(uint32_t size) {
+        // header and rounding
+        uint32_t required = size + 16;
+        return rckid::memoryFreeHeap() >= required || rckid::memoryFragmentation().largestFreeBlock >= required;
+    }
+
+    /** Replays the trace with given allocator functions and returns the time per operation in nanoseconds.
+     */
+    template<typename MALLOC, typename FREE>
+    double timedRun(Trace const & t, std::vector<void *> & slots, MALLOC malloc, FREE free) {
+        auto start = std::chrono::steady_clock::now();
+        for (TraceOp const & op : t.ops) {
+            if (op.size == 0)
+                free(slots[op.slot]);
+            else
+                slots[op.slot] = malloc(op.size);
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::fill(slots.begin(), slots.end(), nullptr);
+        return std::chrono::duration<double, std::nano>(end - start).count() / t.ops.size();
+    }
+
+    TraceResult replay(Trace const & t) {
+        TraceResult result;
+        std::vector<void *> slots(t.numSlots, nullptr);
+        // timed runs without any measurements
+        rckid::memoryEnterArena();
+        result.nsPerOp = timedRun(t, slots, [](uint32_t size) { return rckid::malloc(size); }, [](void * ptr) { rckid::free(ptr); });
+        rckid::memoryLeaveArena();
+        result.hostNsPerOp = timedRun(t, slots, [](uint32_t size) { return std::malloc(size); }, [](void * ptr) { std::free(ptr); });
+        // measured run within the budget
+        rckid::memoryEnterArena();
+        uint32_t freeHeap = rckid::memoryFreeHeap();
+        void * ballast = (freeHeap > t.budget) ? rckid::malloc(freeHeap - t.budget) : nullptr;
+        uint32_t base = rckid::memoryUsedHeap();
+        result.failedAt = t.ops.size();
+        for (size_t i = 0, e = t.ops.size(); i != e; ++i) {
+            TraceOp const & op = t.ops[i];
+            if (op.size == 0) {
+                rckid::free(slots[op.slot]);
+                slots[op.slot] = nullptr;
+                continue;
+            }
+            if (!fits(op.size)) {
+                result.failedAt = i;
+                break;
+            }
+            slots[op.slot] = rckid::malloc(op.size);
+            result.peakHeap = std::max(result.peakHeap, rckid::memoryUsedHeap() - base);
+            if (i % 64 == 0)
+                result.worstFragmentation = std::max(result.worstFragmentation, rckid::memoryFragmentation().percent());
+        }
+        // free whatever is left (only if the trace failed) and check that the heap is whole again
+        for (void * & ptr : slots) {
+            rckid::free(ptr);
+            ptr = nullptr;
+        }
+        rckid::free(ballast);
+        result.leaked = rckid::memoryFreeHeap() != freeHeap;
+        rckid::memoryLeaveArena();
+        std::cout << std::endl << "    " << t.name << ": " << t.ops.size() << " ops, " << result.nsPerOp << " ns/op (host malloc " << result.hostNsPerOp << " ns/op), peak heap " << result.peakHeap << ", worst fragmentation " << result.worstFragmentation << "%";
+        if (result.failedAt != t.ops.size())
+            std::cout << ", FAILED at op " << result.failedAt;
+        std::cout << std::endl;
+        return result;
+    }
+
+} // anonymous namespace
+
+TEST(memoryBenchmark, menuNavigation) {
+    Trace t = menuNavigation();
+    TraceResult r = replay(t);
+    EXPECT(r.failedAt == t.ops.size());
+    EXPECT(r.leaked == false);
+}
+
+TEST(memoryBenchmark, pngLoad) {
+    Trace t = pngLoad();
+    TraceResult r = replay(t);
+    EXPECT(r.failedAt == t.ops.size());
+    EXPECT(r.leaked == false);
+}
+
+TEST(memoryBenchmark, tetrisSession) {
+    Trace t = tetrisSession();
+    TraceResult r = replay(t);
+    EXPECT(r.failedAt == t.ops.size());
+    EXPECT(r.leaked == false);
+}
+
+TEST(memoryBenchmark, commsSession) {
+    Trace t = commsSession();
+    TraceResult r = replay(t);
+    EXPECT(r.failedAt == t.ops.size());
+    EXPECT(r.leaked == false);
+}
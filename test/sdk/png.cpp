@@ -0,0 +1,150 @@
+#include <cstring>
+
+#include <platform/tests.h>
+#include <rckid/graphics/bitmap.h>
+#include <rckid/assets/icons.h>
+
+using namespace rckid;
+
+namespace {
+
+    /** 5x7 palette indexed images, 8bpp with index 16 + x * 5 + y and 4bpp with index (x + 3 * y) & 15.
+     */
+    uint8_t const indexed8[] = {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x08, 0x03, 0x00, 0x00, 0x00, 0xf7, 0x79, 0x77,
+        0xdc, 0x00, 0x00, 0x00, 0x90, 0x50, 0x4c, 0x54, 0x45, 0x00, 0x00, 0xff, 0x05, 0x00, 0xfa, 0x0a,
+        0x00, 0xf5, 0x10, 0x00, 0xef, 0x15, 0x00, 0xea, 0x1b, 0x00, 0xe4, 0x20, 0x00, 0xdf, 0x25, 0x00,
+        0xda, 0x2b, 0x00, 0xd4, 0x30, 0x00, 0xcf, 0x36, 0x00, 0xc9, 0x3b, 0x00, 0xc4, 0x41, 0x00, 0xbe,
+        0x46, 0x00, 0xb9, 0x4b, 0x00, 0xb4, 0x51, 0x00, 0xae, 0x56, 0x00, 0xa9, 0x5c, 0x00, 0xa3, 0x61,
+        0x00, 0x9e, 0x67, 0x00, 0x98, 0x6c, 0x00, 0x93, 0x71, 0x00, 0x8e, 0x77, 0x00, 0x88, 0x7c, 0x00,
+        0x83, 0x82, 0x00, 0x7d, 0x87, 0x00, 0x78, 0x8d, 0x00, 0x72, 0x92, 0x00, 0x6d, 0x97, 0x00, 0x68,
+        0x9d, 0x00, 0x62, 0xa2, 0x00, 0x5d, 0xa8, 0x00, 0x57, 0xad, 0x00, 0x52, 0xb3, 0x00, 0x4c, 0xb8,
+        0x00, 0x47, 0xbd, 0x00, 0x42, 0xc3, 0x00, 0x3c, 0xc8, 0x00, 0x37, 0xce, 0x00, 0x31, 0xd3, 0x00,
+        0x2c, 0xd9, 0x00, 0x26, 0xde, 0x00, 0x21, 0xe3, 0x00, 0x1c, 0xe9, 0x00, 0x16, 0xee, 0x00, 0x11,
+        0xf4, 0x00, 0x0b, 0xf9, 0x00, 0x06, 0xff, 0x00, 0x00, 0x41, 0xf7, 0xff, 0xe4, 0x00, 0x00, 0x00,
+        0x2d, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x10, 0x10, 0x95, 0x92, 0x57, 0x61, 0x10, 0x14,
+        0x93, 0x56, 0x50, 0x65, 0x10, 0x12, 0x97, 0x51, 0x54, 0x63, 0x10, 0x96, 0x90, 0x55, 0x52, 0x67,
+        0x10, 0x91, 0x94, 0x53, 0xd6, 0x60, 0x00, 0x49, 0x6a, 0x32, 0x80, 0x24, 0xb5, 0x00, 0x4e, 0xc7,
+        0x03, 0xf8, 0x94, 0x2f, 0x28, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+        0x60, 0x82,
+    };
+    uint8_t const indexed4[] = {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x32, 0x89, 0x9a,
+        0xdd, 0x00, 0x00, 0x00, 0x30, 0x50, 0x4c, 0x54, 0x45, 0x00, 0x00, 0xff, 0x11, 0x00, 0xee, 0x22,
+        0x00, 0xdd, 0x33, 0x00, 0xcc, 0x44, 0x00, 0xbb, 0x55, 0x00, 0xaa, 0x66, 0x00, 0x99, 0x77, 0x00,
+        0x88, 0x88, 0x00, 0x77, 0x99, 0x00, 0x66, 0xaa, 0x00, 0x55, 0xbb, 0x00, 0x44, 0xcc, 0x00, 0x33,
+        0xdd, 0x00, 0x22, 0xee, 0x00, 0x11, 0xff, 0x00, 0x00, 0x65, 0x86, 0xb6, 0xe9, 0x00, 0x00, 0x00,
+        0x25, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0x54, 0x76, 0x60, 0x30, 0x09, 0x2b, 0x60,
+        0x48, 0xef, 0x5c, 0xc0, 0x30, 0x6b, 0xcf, 0x05, 0x86, 0xb3, 0xef, 0x19, 0x18, 0x3e, 0x08, 0x19,
+        0x30, 0x28, 0xbb, 0x26, 0x00, 0x00, 0x74, 0x6e, 0x08, 0xcb, 0x0f, 0x94, 0x90, 0x29, 0x00, 0x00,
+        0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    };
+
+    uint8_t indexed8At(int x, int y) { return static_cast<uint8_t>(16 + x * 5 + y); }
+    uint8_t indexed4At(int x, int y) { return static_cast<uint8_t>((x + 3 * y) & 15); }
+
+}
+
+TEST(png, loadImageClipped) {
+    memoryEnterArena();
+    Surface<ColorRGB> s{50, 70};
+    Surface<ColorRGB> expected{50, 70};
+    s.fill(color::Black);
+    expected.fill(color::Black);
+    s.loadImage(PNG::fromBuffer(assets::icons::elephant), Point{-5, 10});
+    PNG::fromBuffer(assets::icons::elephant).decode([&](ColorRGB * line, int lineNum, int lineWidth) {
+        for (int i = 0; i < lineWidth; ++i)
+            expected.setPixelAt(i - 5, lineNum + 10, line[i]);
+    });
+    EXPECT(memcmp(s.buffer(), expected.buffer(), pixelBufferSize<ColorRGB>(50, 70)) == 0);
+    memoryLeaveArena();
+}
+
+TEST(png, loadImageAlphaBlend) {
+    memoryEnterArena();
+    Surface<ColorRGB> s{64, 64};
+    Surface<ColorRGB> expected{64, 64};
+    s.fill(color::Red);
+    expected.fill(color::Red);
+    s.loadImage(PNG::fromBuffer(assets::icons::elephant), Point::origin(), true);
+    PNG::fromBuffer(assets::icons::elephant).decode([&](ColorRGB * line, uint8_t const * alpha, int lineNum, int lineWidth) {
+        EXPECT(alpha != nullptr);
+        for (int i = 0; i < lineWidth; ++i)
+            expected.setPixelAt(i, lineNum, line[i].blendOver(color::Red, alpha[i]));
+    });
+    EXPECT(memcmp(s.buffer(), expected.buffer(), pixelBufferSize<ColorRGB>(64, 64)) == 0);
+    // the icons have transparent corners
+    EXPECT(s.pixelAt(0, 0) == color::Red);
+    memoryLeaveArena();
+}
+
+TEST(png, decodeWithScratch) {
+    memoryEnterArena();
+    ScratchArena scratch{1024};
+    int lines = 0;
+    PNG::fromBuffer(assets::icons::elephant).decode([&](ColorRGB *, int, int) { ++lines; }, & scratch);
+    EXPECT(lines == 64);
+    // both line buffers were taken from the scratch and released after the decoding
+    EXPECT(scratch.peak() >= 64 * (sizeof(ColorRGB) + 1));
+    EXPECT(scratch.used() == 0);
+    // scratch too small for the line buffers falls back to the heap
+    ScratchArena small{64};
+    lines = 0;
+    PNG::fromBuffer(assets::icons::elephant).decode([&](ColorRGB *, int, int) { ++lines; }, & small);
+    EXPECT(lines == 64);
+    EXPECT(small.used() == 0);
+    memoryLeaveArena();
+}
+
+TEST(png, decodeIndexed) {
+    memoryEnterArena();
+    PNG png = PNG::fromBuffer(indexed4);
+    EXPECT(png.indexed());
+    EXPECT(png.bpp() == 4);
+    int lines = 0;
+    png.decode(PNG::DecodeIndexedCallback{[&](uint8_t const * indices, int lineNum, int lineWidth) {
+        EXPECT(lineWidth == 5);
+        for (int x = 0; x < lineWidth; ++x)
+            EXPECT(indices[x] == indexed4At(x, lineNum));
+        ++lines;
+    }});
+    EXPECT(lines == 7);
+    memoryLeaveArena();
+}
+
+TEST(png, loadIndexedImage256) {
+    memoryEnterArena();
+    Surface<Color256> s{8, 12};
+    s.fill(Color256{255});
+    s.loadImage(PNG::fromBuffer(indexed8), Point{1, 3});
+    for (int x = 0; x < 8; ++x)
+        for (int y = 0; y < 12; ++y) {
+            bool inside = x >= 1 && x < 6 && y >= 3 && y < 10;
+            EXPECT(s.pixelAt(x, y).toRaw() == (inside ? indexed8At(x - 1, y - 3) : 255));
+        }
+    memoryLeaveArena();
+}
+
+TEST(png, loadIndexedImage16) {
+    memoryEnterArena();
+    // the image starts at an odd row, so that its pixels land in both nibbles of the column bytes
+    Surface<Color16> s{8, 12};
+    s.fill(Color16{15});
+    s.loadImage(PNG::fromBuffer(indexed4), Point{1, 3});
+    for (int x = 0; x < 8; ++x)
+        for (int y = 0; y < 12; ++y) {
+            bool inside = x >= 1 && x < 6 && y >= 3 && y < 10;
+            EXPECT(s.pixelAt(x, y).toRaw() == (inside ? indexed4At(x - 1, y - 3) : 15));
+        }
+    // and at an even row
+    s.fill(Color16{15});
+    s.loadImage(PNG::fromBuffer(indexed4), Point{0, 2});
+    for (int x = 0; x < 5; ++x)
+        for (int y = 0; y < 7; ++y)
+            EXPECT(s.pixelAt(x, y + 2).toRaw() == indexed4At(x, y));
+    EXPECT(s.pixelAt(0, 1).toRaw() == 15);
+    EXPECT(s.pixelAt(0, 9).toRaw() == 15);
+    memoryLeaveArena();
+}
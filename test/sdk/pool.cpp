@@ -0,0 +1,64 @@
+#include <platform/tests.h>
+#include <rckid/rckid.h>
+#include <rckid/utils/pool.h>
+
+namespace {
+    struct PoolItem {
+        uint32_t a;
+        uint32_t b;
+        PoolItem(uint32_t a, uint32_t b): a{a}, b{b} {}
+    };
+}
+
+TEST(pool, createDestroy) {
+    rckid::memoryEnterArena();
+    rckid::Pool<PoolItem, 4> pool;
+    PoolItem * x = pool.create(1, 2);
+    PoolItem * y = pool.create(3, 4);
+    EXPECT(x->a == 1 && x->b == 2);
+    EXPECT(y->a == 3 && y->b == 4);
+    EXPECT(pool.contains(x) && pool.contains(y));
+    EXPECT(pool.size() == 2);
+    pool.destroy(x);
+    EXPECT(pool.size() == 1);
+    // freed slot is reused first
+    EXPECT(pool.create(5, 6) == x);
+    EXPECT(pool.peak() == 2);
+    EXPECT(pool.overflows() == 0);
+    rckid::memoryLeaveArena();
+}
+
+TEST(pool, overflowsToHeap) {
+    rckid::memoryEnterArena();
+    rckid::Pool<PoolItem, 2> pool;
+    PoolItem * a = pool.create(1, 1);
+    PoolItem * b = pool.create(2, 2);
+    uint32_t freeHeap = rckid::memoryFreeHeap();
+    PoolItem * c = pool.create(3, 3);
+    EXPECT(! pool.contains(c));
+    EXPECT(pool.overflows() == 1);
+    EXPECT(rckid::memoryFreeHeap() < freeHeap);
+    pool.destroy(c);
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    pool.destroy(a);
+    pool.destroy(b);
+    EXPECT(pool.size() == 0);
+    rckid::memoryLeaveArena();
+}
+
+TEST(pool, releasedWithArena) {
+    rckid::Pool<PoolItem, 4> pool;
+    uint32_t freeHeap = rckid::memoryFreeHeap();
+    rckid::memoryEnterArena();
+    pool.create(1, 1);
+    pool.create(2, 2);
+    rckid::memoryLeaveArena();
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    EXPECT(pool.size() == 0);
+    // the pool starts anew in the next arena
+    rckid::memoryEnterArena();
+    PoolItem * x = pool.create(3, 3);
+    EXPECT(pool.contains(x));
+    EXPECT(pool.size() == 1);
+    rckid::memoryLeaveArena();
+}
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <iostream>
+
+#include <platform/tests.h>
+#include <rckid/graphics/bitmap.h>
+
+using namespace rckid;
+
+/** Render pipeline benchmark.
+
+    Converts a full screen bitmap of each color depth into the render pipeline chunks with various numbers of columns per chunk, i.e. the work the renderers do in the render() call apart from waiting for the display. Each configuration reports the conversion time per frame and the number of display updates (and therefore completion IRQs) per frame. The results are written to the standard output. The chunks are compared against the bitmap pixels so that the benchmark doubles as a test of the chunk layout.
+ */
+namespace {
+
+    constexpr Coord Width = 320;
+    constexpr Coord Height = 240;
+    constexpr int Frames = 20;
+
+    ColorRGB const * testPalette() {
+        static ColorRGB palette[256];
+        for (int i = 0; i < 256; ++i)
+            palette[i] = ColorRGB::fromRaw(static_cast<uint16_t>(i * 251 + 7));
+        return palette;
+    }
+
+    template<typename COLOR>
+    void fillBitmap(Bitmap<COLOR> & b) {
+        if constexpr (COLOR::BPP != 16)
+            b.setPalette(testPalette());
+        for (Coord x = 0; x < Width; ++x)
+            for (Coord y = 0; y < Height; ++y)
+                b.setPixelAt(x, y, COLOR::fromRaw(static_cast<uint16_t>((x * 7 + y * 13) & ((1 << COLOR::BPP) - 1))));
+    }
+
+    template<typename COLOR>
+    ColorRGB expectedPixel(Bitmap<COLOR> const & b, Coord x, Coord y) {
+        if constexpr (COLOR::BPP == 16)
+            return b.pixelAt(x, y);
+        else
+            return b.palette()[b.pixelAt(x, y).toRaw()];
+    }
+
+    /** Converts all chunks of the frame for given number of frames and returns ns per frame, checking the chunk contents in the first frame.
+     */
+    template<typename COLOR>
+    bool benchmark(char const * name, uint32_t chunkColumns, Rect rect) {
+        Bitmap<COLOR> b{Width, Height};
+        fillBitmap(b);
+        RenderPipeline p;
+        p.initialize(Height, chunkColumns, 2);
+        p.setFrame(rect.left(), rect.right(), rect.h);
+        auto renderColumn = [&](Coord column, ColorRGB * buffer) {
+            uint8_t const * sb = b.buffer() + pixelBufferColumnOffset<COLOR>(Width, Height, column) + rect.y * COLOR::BPP / 8;
+            pixelBufferToRGB<COLOR>(sb, buffer, rect.h, b.palette(), 0);
+        };
+        uint32_t numChunks = p.numChunks(rect.w);
+        bool ok = true;
+        for (uint32_t c = 0; c < numChunks; ++c) {
+            ColorRGB const * chunk = p.renderChunk(c, renderColumn);
+            for (Coord i = 0; i < static_cast<Coord>(chunkColumns); ++i) {
+                Coord x = rect.right() - 1 - static_cast<Coord>(c * chunkColumns) - i;
+                if (x < rect.left())
+                    break;
+                for (Coord y = 0; y < rect.h; ++y)
+                    ok = ok && (chunk[i * rect.h + y] == expectedPixel(b, x, rect.y + y));
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < Frames; ++f)
+            for (uint32_t c = 0; c < numChunks; ++c)
+                p.renderChunk(c, renderColumn);
+        auto end = std::chrono::steady_clock::now();
+        double usPerFrame = std::chrono::duration<double, std::micro>(end - start).count() / Frames;
+        std::cout << std::endl << "    " << name << " " << rect.w << "x" << rect.h << ", " << chunkColumns << " columns per chunk: " << numChunks << " updates per frame, " << usPerFrame << " us per frame";
+        p.finalize();
+        return ok;
+    }
+
+    template<typename COLOR>
+    bool benchmarkAll(char const * name) {
+        bool ok = true;
+        for (uint32_t n : {1, 2, 4, 8, 16})
+            ok = benchmark<COLOR>(name, n, Rect::WH(Width, Height)) && ok;
+        // partial update with a chunk not dividing the width
+        ok = benchmark<COLOR>(name, 3, Rect::XYWH(10, 20, 101, 64)) && ok;
+        std::cout << std::endl;
+        return ok;
+    }
+
+} // anonymous namespace
+
+TEST(renderBenchmark, color16) {
+    memoryEnterArena();
+    EXPECT(benchmarkAll<Color16>("Color16"));
+    memoryLeaveArena();
+}
+
+TEST(renderBenchmark, color256) {
+    memoryEnterArena();
+    EXPECT(benchmarkAll<Color256>("Color256"));
+    memoryLeaveArena();
+}
+
+TEST(renderBenchmark, colorRGB) {
+    memoryEnterArena();
+    EXPECT(benchmarkAll<ColorRGB>("ColorRGB"));
+    memoryLeaveArena();
+}
@@ -0,0 +1,59 @@
+#include <platform/tests.h>
+#include <rckid/rckid.h>
+#include <rckid/app.h>
+
+TEST(scratchArena, bumpAllocation) {
+    rckid::memoryEnterArena();
+    rckid::ScratchArena scratch{256};
+    uint32_t freeHeap = rckid::memoryFreeHeap();
+    uint8_t * a = scratch.alloc<uint8_t>(3);
+    uint32_t * b = scratch.alloc<uint32_t>(4);
+    EXPECT(reinterpret_cast<uintptr_t>(b) % alignof(uint32_t) == 0);
+    EXPECT(reinterpret_cast<uint8_t *>(b) >= a + 3);
+    EXPECT(scratch.used() == 4 + 16);
+    // the heap is never touched
+    EXPECT(rckid::memoryFreeHeap() == freeHeap);
+    scratch.reset();
+    EXPECT(scratch.used() == 0);
+    EXPECT(scratch.peak() == 4 + 16);
+    EXPECT(scratch.alloc<uint8_t>(3) == a);
+    void * aligned = scratch.alloc(10, 64);
+    EXPECT(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    rckid::memoryLeaveArena();
+}
+
+TEST(scratchArena, scope) {
+    rckid::memoryEnterArena();
+    rckid::ScratchArena scratch{256};
+    scratch.alloc(16);
+    {
+        rckid::ScratchArena::Scope scope{scratch};
+        scratch.alloc(100);
+        EXPECT(scratch.used() == 116);
+    }
+    EXPECT(scratch.used() == 16);
+    rckid::memoryLeaveArena();
+}
+
+TEST(scratchArena, tryAlloc) {
+    rckid::memoryEnterArena();
+    rckid::ScratchArena scratch{64};
+    EXPECT(scratch.tryAlloc(100) == nullptr);
+    EXPECT(scratch.used() == 0);
+    EXPECT(scratch.tryAlloc<uint32_t>(16) != nullptr);
+    EXPECT(scratch.tryAlloc<uint8_t>(1) == nullptr);
+    rckid::memoryLeaveArena();
+}
+
+TEST(scratchArena, frameScratch) {
+    rckid::memoryEnterArena();
+    EXPECT(rckid::App::hasFrameScratch() == false);
+    rckid::ScratchArena scratch{64};
+    {
+        rckid::App::FrameScratch frameScratch{scratch};
+        EXPECT(rckid::App::hasFrameScratch());
+        EXPECT(& rckid::App::frameScratch() == & scratch);
+    }
+    EXPECT(rckid::App::hasFrameScratch() == false);
+    rckid::memoryLeaveArena();
+}
@@ -0,0 +1,97 @@
+#include <platform/tests.h>
+#include <rckid/graphics/sprite.h>
+
+using namespace rckid;
+
+namespace {
+
+    /** Checks all columns of the sprite at all vertical positions partially or fully inside a buffer against per-pixel reference.
+     */
+    template<typename COLOR>
+    bool checkClippedColumns(Sprite<COLOR> & s, ColorRGB const * palette) {
+        constexpr int bufferHeight = 20;
+        ColorRGB buffer[bufferHeight];
+        ColorRGB expected[bufferHeight];
+        for (int y = -s.height() - 1; y <= bufferHeight + 1; ++y) {
+            s.setPos(3, y);
+            for (int x = 2; x < 3 + s.width() + 1; ++x) {
+                for (int i = 0; i < bufferHeight; ++i) {
+                    buffer[i] = ColorRGB::fromRaw(0xffff);
+                    expected[i] = ColorRGB::fromRaw(0xffff);
+                    int sy = i - y;
+                    int sx = x - 3;
+                    if (sx < 0 || sx >= s.width() || sy < 0 || sy >= s.height())
+                        continue;
+                    if constexpr (COLOR::BPP == 16) {
+                        ColorRGB c = s.pixelAt(sx, sy);
+                        if (c != s.transparentColor())
+                            expected[i] = c;
+                    } else {
+                        uint8_t c = s.pixelAt(sx, sy).toRaw();
+                        if (c != 0)
+                            expected[i] = palette[(c + s.paletteOffset()) & 0xff];
+                    }
+                }
+                s.renderColumn(x, buffer, bufferHeight, palette);
+                for (int i = 0; i < bufferHeight; ++i)
+                    if (buffer[i] != expected[i])
+                        return false;
+            }
+        }
+        return true;
+    }
+
+    ColorRGB const * testPalette() {
+        static ColorRGB palette[256];
+        for (int i = 0; i < 256; ++i)
+            palette[i] = ColorRGB::fromRaw(static_cast<uint16_t>(i * 251 + 7));
+        return palette;
+    }
+
+}
+
+TEST(sprite, clippedColumns16) {
+    memoryEnterArena();
+    Sprite<Color16> s{5, 6};
+    for (int x = 0; x < 5; ++x)
+        for (int y = 0; y < 6; ++y)
+            s.setPixelAt(x, y, Color16{static_cast<uint8_t>((x * 7 + y * 3) % 16)});
+    s.setPaletteOffset(3);
+    EXPECT(checkClippedColumns(s, testPalette()));
+    memoryLeaveArena();
+}
+
+TEST(sprite, clippedColumns256) {
+    memoryEnterArena();
+    Sprite<Color256> s{4, 7};
+    for (int x = 0; x < 4; ++x)
+        for (int y = 0; y < 7; ++y)
+            s.setPixelAt(x, y, Color256{static_cast<uint8_t>((x * 31 + y * 5) % 7)});
+    EXPECT(checkClippedColumns(s, testPalette()));
+    memoryLeaveArena();
+}
+
+TEST(sprite, clippedColumnsRGB) {
+    memoryEnterArena();
+    Sprite<ColorRGB> s{4, 5};
+    s.transparentColor(color::Black);
+    for (int x = 0; x < 4; ++x)
+        for (int y = 0; y < 5; ++y)
+            s.setPixelAt(x, y, ((x + y) % 3 == 0) ? color::Black : ColorRGB::fromRaw(static_cast<uint16_t>(x * 1000 + y)));
+    EXPECT(checkClippedColumns<ColorRGB>(s, nullptr));
+    memoryLeaveArena();
+}
+
+TEST(sprite, invisible) {
+    memoryEnterArena();
+    Sprite<Color256> s{2, 2};
+    s.fill(Color256{1});
+    s.setVisible(false);
+    ColorRGB buffer[4] = {};
+    EXPECT(s.renderColumn(0, buffer, 4, testPalette()) == false);
+    EXPECT(buffer[0] == ColorRGB{});
+    s.setVisible(true);
+    EXPECT(s.renderColumn(0, buffer, 4, testPalette()));
+    EXPECT(buffer[0] == testPalette()[1]);
+    memoryLeaveArena();
+}
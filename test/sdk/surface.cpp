@@ -1,5 +1,11 @@
+#include <cstring>
+#include <vector>
+
 #include <platform/tests.h>
+#include <rckid/internals.h>
 #include <rckid/graphics/bitmap.h>
+#include <rckid/assets/fonts/Iosevka16.h>
+#include <rckid/assets/fonts/OpenDyslexic64.h>
 
 using namespace rckid;
 
@@ -34,3 +40,266 @@ TEST(surface, pixels_bpp4) {
 
     memoryLeaveArena();
 }
+
+namespace {
+    /** Blits the source rectangle into both a surface and a per-pixel reference and compares the results, which covers clipping and, for 4bpp, all nibble alignments.
+     */
+    template<typename COLOR>
+    bool blitMatchesPerPixel(Point where, Rect srcRect) {
+        Surface<COLOR> src{20, 16};
+        for (int x = 0; x < 20; ++x)
+            for (int y = 0; y < 16; ++y)
+                src.setPixelAt(x, y, COLOR::fromRaw((x * 7 + y * 3 + 1) % (1 << std::min<int>(COLOR::BPP, 8))));
+        Surface<COLOR> dst{32, 24};
+        Surface<COLOR> expected{32, 24};
+        dst.fill(COLOR::fromRaw(0));
+        expected.fill(COLOR::fromRaw(0));
+        dst.blit(where, src, srcRect);
+        for (int x = 0; x < srcRect.w; ++x)
+            for (int y = 0; y < srcRect.h; ++y) {
+                int sx = srcRect.x + x;
+                int sy = srcRect.y + y;
+                if (sx >= 0 && sy >= 0 && sx < src.width() && sy < src.height())
+                    expected.setPixelAt(where.x + x, where.y + y, src.pixelAt(sx, sy));
+            }
+        return memcmp(dst.buffer(), expected.buffer(), pixelBufferSize<COLOR>(32, 24)) == 0;
+    }
+
+    template<typename COLOR>
+    bool blitMatchesPerPixel() {
+        for (int y = -3; y < 4; ++y)
+            for (int sy = -1; sy < 3; ++sy)
+                for (int h = 1; h < 6; ++h) {
+                    if (!blitMatchesPerPixel<COLOR>(Point{3, y}, Rect::XYWH(2, sy, 3, h)))
+                        return false;
+                    if (!blitMatchesPerPixel<COLOR>(Point{-2, 20 + y}, Rect::XYWH(-1, 12 + sy, 5, h)))
+                        return false;
+                }
+        // larger than the target
+        return blitMatchesPerPixel<COLOR>(Point{25, -5}, Rect::XYWH(0, 0, 20, 16));
+    }
+}
+
+TEST(surface, blit_bpp16) {
+    memoryEnterArena();
+    EXPECT(blitMatchesPerPixel<ColorRGB>());
+    memoryLeaveArena();
+}
+
+TEST(surface, blit_bpp8) {
+    memoryEnterArena();
+    EXPECT(blitMatchesPerPixel<Color256>());
+    memoryLeaveArena();
+}
+
+TEST(surface, blit_bpp4) {
+    memoryEnterArena();
+    EXPECT(blitMatchesPerPixel<Color16>());
+    memoryLeaveArena();
+}
+
+namespace {
+    template<typename COLOR>
+    bool fillMatchesPerPixel(Rect rect) {
+        Surface<COLOR> s{16, 12};
+        Surface<COLOR> expected{16, 12};
+        s.fill(COLOR::fromRaw(1));
+        expected.fill(COLOR::fromRaw(1));
+        s.fill(COLOR::fromRaw(7), rect);
+        for (int x = rect.left(); x < rect.right(); ++x)
+            for (int y = rect.top(); y < rect.bottom(); ++y)
+                expected.setPixelAt(x, y, COLOR::fromRaw(7));
+        return memcmp(s.buffer(), expected.buffer(), pixelBufferSize<COLOR>(16, 12)) == 0;
+    }
+
+    template<typename COLOR>
+    bool fillMatchesPerPixel() {
+        for (int y = -2; y < 12; ++y)
+            for (int h = 0; h < 14; ++h)
+                if (!fillMatchesPerPixel<COLOR>(Rect::XYWH(y - 3, y, 5, h)))
+                    return false;
+        return fillMatchesPerPixel<COLOR>(Rect::XYWH(-5, -5, 30, 30));
+    }
+}
+
+TEST(surface, fillRect_bpp16) {
+    memoryEnterArena();
+    EXPECT(fillMatchesPerPixel<ColorRGB>());
+    memoryLeaveArena();
+}
+
+TEST(surface, fillRect_bpp8) {
+    memoryEnterArena();
+    EXPECT(fillMatchesPerPixel<Color256>());
+    memoryLeaveArena();
+}
+
+TEST(surface, fillRect_bpp4) {
+    memoryEnterArena();
+    EXPECT(fillMatchesPerPixel<Color16>());
+    memoryLeaveArena();
+}
+
+namespace {
+    /** Draws the character pixel by pixel the way putChar used to, as a reference for the clipped column renderer.
+     */
+    template<typename COLOR>
+    void putCharPerPixel(Surface<COLOR> & s, Point where, Font const & font, char c, COLOR const * colors) {
+        GlyphInfo const & g = font.glyphs[c - 32];
+        uint32_t const * pixels = font.pixels + g.index;
+        for (int x = where.x + g.x, xe = where.x + g.x + g.width; x < xe; ++x) {
+            uint32_t col = 0;
+            uint32_t bits = 0;
+            for (int y = where.y + g.y, ye = where.y + g.y + g.height; y != ye; ++y) {
+                if (bits == 0) {
+                    bits = 32;
+                    col = *pixels++;
+                }
+                unsigned a = (col >> 30) & 0x3;
+                if (a != 0)
+                    s.setPixelAt(x, y, colors[a]);
+                col = col << 2;
+                bits -= 2;
+            }
+        }
+    }
+
+    template<typename COLOR>
+    bool putCharMatchesPerPixel(Font const & font, GlyphCache * cache) {
+        COLOR colors[] = { COLOR::fromRaw(0), COLOR::fromRaw(3), COLOR::fromRaw(5), COLOR::fromRaw(7) };
+        Surface<COLOR> s{48, 40};
+        Surface<COLOR> expected{48, 40};
+        for (char c : { 'A', 'g', 'W', '@' }) {
+            for (int x = -40; x < 48; x += 7) {
+                for (int y = -font.size; y < 40; y += 5) {
+                    s.fill(COLOR::fromRaw(1));
+                    expected.fill(COLOR::fromRaw(1));
+                    s.putChar(Point{x, y}, font, c, colors, cache);
+                    putCharPerPixel(expected, Point{x, y}, font, c, colors);
+                    if (memcmp(s.buffer(), expected.buffer(), pixelBufferSize<COLOR>(48, 40)) != 0)
+                        return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+TEST(surface, putChar) {
+    memoryEnterArena();
+    Font f16 = Font::fromROM<assets::font::Iosevka16>();
+    EXPECT(putCharMatchesPerPixel<ColorRGB>(f16, nullptr));
+    EXPECT(putCharMatchesPerPixel<Color16>(f16, nullptr));
+    EXPECT(putCharMatchesPerPixel<ColorRGB>(assets::font::OpenDyslexic64::font, nullptr));
+    EXPECT(putCharMatchesPerPixel<Color256>(assets::font::OpenDyslexic64::font, nullptr));
+    memoryLeaveArena();
+}
+
+TEST(surface, putCharCached) {
+    memoryEnterArena();
+    GlyphCache cache{2};
+    EXPECT(putCharMatchesPerPixel<ColorRGB>(assets::font::OpenDyslexic64::font, & cache));
+    EXPECT(putCharMatchesPerPixel<Color16>(Font::fromROM<assets::font::Iosevka16>(), & cache));
+    // four characters cycling through two entries miss once per character and font, then hit for all the positions
+    EXPECT(cache.misses() == 8);
+    EXPECT(cache.hits() > 0);
+    memoryLeaveArena();
+}
+
+namespace {
+    bool sameRect(Rect a, Rect b) {
+        return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+    }
+}
+
+TEST(surface, dirtyRegion) {
+    memoryEnterArena();
+    Surface<ColorRGB> s{100, 50};
+    EXPECT(sameRect(s.dirtyRect(), Rect::WH(100, 50)));
+    s.clearDirty();
+    EXPECT(s.dirty() == false);
+    s.setPixelAt(10, 20, color::White);
+    EXPECT(sameRect(s.dirtyRect(), Rect::XYWH(10, 20, 1, 1)));
+    s.fill(color::Red, Rect::XYWH(-5, 30, 8, 40));
+    EXPECT(sameRect(s.dirtyRect(), Rect::XYWH(0, 20, 11, 30)));
+    s.clearDirty();
+    // out of surface operations do not mark anything
+    s.setPixelAt(-1, 5, color::White);
+    s.fill(color::Red, Rect::XYWH(100, 0, 10, 10));
+    EXPECT(s.dirty() == false);
+    Surface<ColorRGB> src{8, 8};
+    s.blit(Point{96, -2}, src);
+    EXPECT(sameRect(s.dirtyRect(), Rect::XYWH(96, 0, 4, 6)));
+    s.clearDirty();
+    ColorRGB colors[] = { color::Black, color::White, color::White, color::White };
+    s.putChar(Point{40, 10}, Font::fromROM<assets::font::Iosevka16>(), 'A', colors);
+    EXPECT(s.dirty());
+    EXPECT(s.dirtyRect().x >= 40 && s.dirtyRect().right() <= 40 + Font::fromROM<assets::font::Iosevka16>().textWidth("A"));
+    memoryLeaveArena();
+}
+
+TEST(surface, mutableBufferMarksDirty) {
+    memoryEnterArena();
+    Surface<ColorRGB> s{100, 50};
+    s.clearDirty();
+    // reading the buffer does not change anything
+    Surface<ColorRGB> const & cs = s;
+    EXPECT(cs.buffer() != nullptr);
+    EXPECT(s.dirty() == false);
+    // but anything can be written through the mutable one
+    s.buffer()[0] = 0xff;
+    EXPECT(sameRect(s.dirtyRect(), Rect::WH(100, 50)));
+    memoryLeaveArena();
+}
+
+TEST(surface, displayUpdateRect) {
+    memoryEnterArena();
+    Surface<Color16> s{100, 50};
+    s.clearDirty();
+    EXPECT(displayUpdateRect(s).empty());
+    s.setPixelAt(10, 21, Color16{1});
+    // 4bpp rows are extended to whole bytes
+    EXPECT(sameRect(displayUpdateRect(s), Rect::XYWH(10, 20, 1, 2)));
+    // large dirty region is sent entirely
+    s.fill(Color16{2}, Rect::XYWH(0, 0, 80, 40));
+    EXPECT(sameRect(displayUpdateRect(s), Rect::WH(100, 50)));
+    memoryLeaveArena();
+}
+
+TEST(surface, renderDirtyColumnsRGB) {
+    memoryEnterArena();
+    Bitmap<ColorRGB> b{40, 30};
+    for (Coord x = 0; x < 40; ++x)
+        for (Coord y = 0; y < 30; ++y)
+            b.setPixelAt(x, y, ColorRGB::fromRaw(static_cast<uint16_t>(x * 31 + y * 7)));
+    Renderer<Bitmap<ColorRGB>> r;
+    r.initialize(b);
+    Rect region = displayUpdateRegion();
+    std::vector<Point> points;
+    std::vector<ColorRGB> colors;
+    displayCapture([&](Coord x, Coord y, ColorRGB const & c) { points.push_back(Point{x, y}); colors.push_back(c); });
+    r.render(b);
+    displayWaitUpdateDone();
+    points.clear();
+    colors.clear();
+    // nothing is sent when the bitmap has not changed
+    r.render(b);
+    displayWaitUpdateDone();
+    EXPECT(points.empty());
+    // partial height dirty region is sent as whole columns, from the right
+    b.setPixelAt(7, 3, color::White);
+    b.setPixelAt(9, 4, color::Red);
+    r.render(b);
+    displayWaitUpdateDone();
+    displayCapture(nullptr);
+    EXPECT(points.size() == 3 * 30);
+    bool ok = points.size() == 3 * 30;
+    for (size_t i = 0; ok && i < points.size(); ++i) {
+        Coord x = 9 - static_cast<Coord>(i) / 30;
+        Coord y = static_cast<Coord>(i) % 30;
+        ok = points[i].x == region.x + x && points[i].y == region.y + y && colors[i] == b.pixelAt(x, y);
+    }
+    EXPECT(ok);
+    r.finalize();
+    memoryLeaveArena();
+}
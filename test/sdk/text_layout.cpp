@@ -0,0 +1,81 @@
+#include <cstring>
+
+#include <platform/tests.h>
+#include <rckid/graphics/text_layout.h>
+#include <rckid/assets/fonts/Iosevka16.h>
+
+using namespace rckid;
+
+namespace {
+    Font const font = Font::fromROM<assets::font::Iosevka16>();
+}
+
+TEST(textLayout, measure) {
+    memoryEnterArena();
+    Rect r = TextLayout::measure(font, "Hello");
+    EXPECT(r.w == font.textWidth("Hello"));
+    EXPECT(r.h == font.size);
+    r = TextLayout::measure(font, "Hello\nWorld!");
+    EXPECT(r.w == font.textWidth("World!"));
+    EXPECT(r.h == font.size * 2);
+    EXPECT(TextLayout::measure(font, "").w == 0);
+    memoryLeaveArena();
+}
+
+TEST(textLayout, wordWrap) {
+    memoryEnterArena();
+    // Iosevka is monospace so the width is simply number of characters times the advance
+    int adv = font.textWidth("a");
+    TextLayout t{font, "one two three", adv * 8};
+    EXPECT(t.numLines() == 2);
+    EXPECT(t.lineWidth(0) == adv * 7); // "one two"
+    EXPECT(t.lineWidth(1) == adv * 5); // "three"
+    EXPECT(t.width() == adv * 7);
+    EXPECT(t.truncated() == false);
+    // words longer than the line are broken
+    t.layout(font, "abcdefghij", adv * 4);
+    EXPECT(t.numLines() == 3);
+    EXPECT(t.lineWidth(2) == adv * 2);
+    memoryLeaveArena();
+}
+
+TEST(textLayout, ellipsis) {
+    memoryEnterArena();
+    int adv = font.textWidth("a");
+    TextLayout t{font, "abcdefghij", adv * 6, 1};
+    EXPECT(t.numLines() == 1);
+    EXPECT(t.truncated());
+    // three characters and the ellipsis
+    EXPECT(t.width() == adv * 6);
+    t.layout(font, "abcdef", adv * 6, 1);
+    EXPECT(t.truncated() == false);
+    t.layout(font, "one two three four", adv * 8, 2);
+    EXPECT(t.numLines() == 2);
+    EXPECT(t.truncated());
+    EXPECT(t.lineWidth(1) <= adv * 8);
+    memoryLeaveArena();
+}
+
+TEST(textLayout, reuse) {
+    memoryEnterArena();
+    TextLayout t;
+    EXPECT(t.layout(font, "Hello", 100) == true);
+    char text[] = "Hello";
+    EXPECT(t.layout(font, text, 100) == false);
+    text[0] = 'J';
+    EXPECT(t.layout(font, text, 100) == true);
+    EXPECT(t.layout(font, text, 50) == true);
+    memoryLeaveArena();
+}
+
+TEST(textLayout, drawOnMatchesText) {
+    memoryEnterArena();
+    Surface<ColorRGB> s{160, 40};
+    Surface<ColorRGB> expected{160, 40};
+    s.fill(color::Black);
+    expected.fill(color::Black);
+    TextLayout{font, "Hello\nWorld"}.drawOn(s, Point{-3, 5}, color::White);
+    expected.text(-3, 5, font, color::White) << "Hello\nWorld";
+    EXPECT(memcmp(s.buffer(), expected.buffer(), pixelBufferSize<ColorRGB>(160, 40)) == 0);
+    memoryLeaveArena();
+}
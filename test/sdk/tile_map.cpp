@@ -0,0 +1,118 @@
+#include <cstdlib>
+
+#include <platform/tests.h>
+#include <rckid/graphics/tile_map.h>
+
+using namespace rckid;
+
+namespace {
+
+    using TestTile = Tile<8, 8, Color16>;
+
+    TestTile const * testTiles() {
+        static TestTile tiles[] = {
+            TestTile{{0}}, TestTile{{0}}, TestTile{{0}}, TestTile{{0}},
+        };
+        for (uint8_t i = 0; i < 4; ++i)
+            for (int x = 0; x < 8; ++x)
+                for (int y = 0; y < 8; ++y)
+                    tiles[i].setPixelAt(x, y, Color16{static_cast<uint8_t>((x * 3 + y * 5 + i * 7) % 16)});
+        return tiles;
+    }
+
+    ColorRGB const * testPalette() {
+        static ColorRGB palette[256];
+        for (int i = 0; i < 256; ++i)
+            palette[i] = ColorRGB::fromRaw(static_cast<uint16_t>(i * 251 + 7));
+        return palette;
+    }
+
+    Coord wrap(Coord x, Coord size) {
+        x %= size;
+        return x < 0 ? x + size : x;
+    }
+
+    /** Per pixel reference rendering of the engine.
+     */
+    template<uint32_t LAYERS>
+    ColorRGB referencePixel(TileMapEngine<TestTile, LAYERS> const & te, Coord const * columnScroll, Coord x, Coord y) {
+        ColorRGB result;
+        bool first = true;
+        for (uint32_t i = 0; i < LAYERS; ++i) {
+            auto const & l = te.layer(i);
+            if (!l.visible())
+                continue;
+            Coord mx = wrap(x + l.scrollX(), l.pixelWidth());
+            Coord my = wrap(y + l.scrollY() + ((i == 1) ? columnScroll[x] : 0), l.pixelHeight());
+            TileMapInfo const & t = l.at(mx / 8, my / 8);
+            Coord px = t.flipH() ? 7 - mx % 8 : mx % 8;
+            Coord py = t.flipV() ? 7 - my % 8 : my % 8;
+            uint8_t c = l.tiles()[t.tile].pixelAt(px, py).toRaw();
+            if (first || c != 0)
+                result = te.palette()[(c + t.paletteOffset) & 0xff];
+            first = false;
+        }
+        return result;
+    }
+
+}
+
+TEST(tileMap, tileRenderColumnRuns) {
+    TestTile const & t = testTiles()[1];
+    ColorRGB const * palette = testPalette();
+    for (int x = 0; x < 8; ++x) {
+        for (int y = 0; y < 8; ++y) {
+            for (int n = 1; y + n <= 8; ++n) {
+                for (int flags = 0; flags < 4; ++flags) {
+                    bool transparent = flags & 1;
+                    bool flipV = flags & 2;
+                    ColorRGB buffer[8];
+                    ColorRGB expected[8];
+                    for (int i = 0; i < 8; ++i)
+                        buffer[i] = expected[i] = ColorRGB::fromRaw(0xffff);
+                    for (int i = 0; i < n; ++i) {
+                        uint8_t c = t.pixelAt(x, flipV ? 7 - y - i : y + i).toRaw();
+                        if (c != 0 || !transparent)
+                            expected[i] = palette[(c + 5) & 0xff];
+                    }
+                    EXPECT(t.renderColumn(x, y, n, buffer, palette, 5, transparent, flipV) == buffer + n);
+                    for (int i = 0; i < 8; ++i)
+                        EXPECT(buffer[i] == expected[i]);
+                }
+            }
+        }
+    }
+}
+
+TEST(tileMap, layersScrollAndFlips) {
+    memoryEnterArena();
+    TileMapEngine<TestTile, 2> te{40, 24, testPalette()};
+    // background smaller than the screen, foreground larger so that both wrap
+    te.layer(0).resize(3, 2);
+    te.layer(1).resize(7, 5);
+    for (uint32_t i = 0; i < 2; ++i) {
+        auto & l = te.layer(i);
+        l.setTiles(testTiles());
+        for (int x = 0; x < l.width(); ++x)
+            for (int y = 0; y < l.height(); ++y)
+                l.at(x, y) = TileMapInfo{static_cast<uint16_t>(std::rand() % 4), static_cast<uint8_t>(std::rand() % 32), static_cast<uint8_t>(std::rand() % 4)};
+    }
+    Coord columnScroll[40];
+    for (int i = 0; i < 40; ++i)
+        columnScroll[i] = (i * 3) % 11 - 5;
+    te.layer(1).setColumnScroll(columnScroll);
+    ColorRGB buffer[24];
+    bool ok = true;
+    for (int frame = 0; frame < 20; ++frame) {
+        te.layer(0).scrollBy(-1, 3);
+        te.layer(1).scrollBy(5, -2);
+        te.layer(0).setVisible(frame % 5 != 4);
+        for (int x = 0; x < 40; ++x) {
+            te.renderColumn(x, buffer);
+            for (int y = 0; y < 24; ++y)
+                ok = ok && (buffer[y] == referencePixel(te, columnScroll, x, y));
+        }
+    }
+    EXPECT(ok);
+    memoryLeaveArena();
+}
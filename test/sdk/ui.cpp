@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <vector>
+
+#include <platform/tests.h>
+#include <rckid/ui/ui.h>
+
+using namespace rckid;
+
+namespace {
+
+    using Engine = UITileEngine<>;
+
+    ColorRGB const * testPalette() {
+        static ColorRGB palette[256];
+        for (int i = 0; i < 256; ++i)
+            palette[i] = ColorRGB::fromRaw(static_cast<uint16_t>(i * 251 + 7));
+        return palette;
+    }
+
+    /** Fills the sprite with a pattern unique to the seed, leaving some pixels transparent.
+     */
+    void fillSprite(Engine::Sprite & s, int seed) {
+        for (int x = 0; x < s.width(); ++x)
+            for (int y = 0; y < s.height(); ++y)
+                s.setPixelAt(x, y, Color16{static_cast<uint8_t>((x * 3 + y * 5 + seed * 7) % 16)});
+    }
+
+    /** Reference rendering of the column the way the renderer did before the sprites were indexed, i.e. asking every sprite about every column, in their z-order.
+     */
+    void fullScanColumn(Engine & te, Coord column, ColorRGB * buffer) {
+        ColorRGB * rb = buffer;
+        for (int ty = 0; ty < te.height(); ++ty) {
+            UITileInfo const & tile = te.at(column / Engine::Tile::Width, ty);
+            rb = te.tiles()[static_cast<uint8_t>(tile.c)].renderColumn(column % Engine::Tile::Width, rb, te.palette(), tile.paletteOffset);
+        }
+        std::vector<Engine::Sprite *> sprites;
+        for (size_t i = 0; i < te.numSprites(); ++i)
+            sprites.push_back(& te.getSprite(i));
+        std::stable_sort(sprites.begin(), sprites.end(), [](Engine::Sprite * a, Engine::Sprite * b) {
+            return a->z() < b->z();
+        });
+        for (Engine::Sprite * s : sprites)
+            s->renderColumn(column, buffer, te.pixelHeight(), te.palette());
+    }
+
+    /** Renders the whole frame column by column from right to left and checks every column against the full scan reference.
+     */
+    bool checkFrame(Engine & te) {
+        Renderer<Engine> r;
+        ScratchArena scratch{1024};
+        r.indexSprites(te, scratch);
+        ColorRGB buffer[96];
+        ColorRGB expected[96];
+        bool ok = true;
+        for (Coord column = te.pixelWidth() - 1; column >= 0; --column) {
+            r.renderColumn(column, buffer, te);
+            fullScanColumn(te, column, expected);
+            for (int i = 0; i < te.pixelHeight(); ++i)
+                ok = ok && (buffer[i] == expected[i]);
+        }
+        return ok;
+    }
+
+    void fillTiles(Engine & te) {
+        for (int x = 0; x < te.width(); ++x)
+            for (int y = 0; y < te.height(); ++y)
+                te.at(x, y) = UITileInfo{static_cast<char>('A' + (x + y) % 26), static_cast<uint8_t>(y * 16)};
+    }
+}
+
+TEST(ui, spritesPartiallyOffScreen) {
+    memoryEnterArena();
+    {
+        Engine te{26, 4, UITiles::Tileset, testPalette()};
+        fillTiles(te);
+        Point positions[] = {
+            { -10, 20 },                                 // left edge
+            { te.pixelWidth() - 7, 30 },                 // right edge
+            { 100, -15 },                                // top edge
+            { 150, te.pixelHeight() - 5 },               // bottom edge
+            { -12, -20 },                                // top left corner
+            { te.pixelWidth() - 3, te.pixelHeight() - 3 }, // bottom right corner
+            { -24, 10 },                                 // just past the left edge
+            { te.pixelWidth(), 10 },                     // just past the right edge
+        };
+        int seed = 0;
+        for (Point p : positions) {
+            Engine::Sprite & s = te.addSprite(24, 24);
+            fillSprite(s, seed++);
+            s.setPos(p.x, p.y);
+        }
+        EXPECT(checkFrame(te));
+    }
+    memoryLeaveArena();
+}
+
+TEST(ui, overlappingSpritesSameZ) {
+    memoryEnterArena();
+    {
+        Engine te{26, 4, UITiles::Tileset, testPalette()};
+        fillTiles(te);
+        // chain of overlapping sprites with different spans, all drawn in the order they were added
+        for (int i = 0; i < 6; ++i) {
+            Engine::Sprite & s = te.addSprite(20 + i * 4, 24);
+            fillSprite(s, i);
+            s.setPos(40 + i * 11, 10 + i * 5);
+        }
+        EXPECT(checkFrame(te));
+    }
+    memoryLeaveArena();
+}
+
+TEST(ui, overlappingSpritesDifferentZ) {
+    memoryEnterArena();
+    {
+        Engine te{26, 4, UITiles::Tileset, testPalette()};
+        fillTiles(te);
+        // sprites added later are given lower z so that the z-order differs from the order of adding
+        int z[] = { 3, -1, 2, 2, 0, -5 };
+        for (int i = 0; i < 6; ++i) {
+            Engine::Sprite & s = te.addSprite(30 - i * 2, 24);
+            fillSprite(s, i);
+            s.setPos(60 + i * 7, 5 + i * 8);
+            s.setZ(z[i]);
+        }
+        EXPECT(checkFrame(te));
+        // changing the z-order between frames is picked up by the next frame
+        te.getSprite(5).setZ(10);
+        te.getSprite(0).setZ(-10);
+        EXPECT(checkFrame(te));
+    }
+    memoryLeaveArena();
+}
+
+TEST(ui, spriteBecomesInvisible) {
+    memoryEnterArena();
+    {
+        Engine te{26, 4, UITiles::Tileset, testPalette()};
+        fillTiles(te);
+        for (int i = 0; i < 3; ++i) {
+            Engine::Sprite & s = te.addSprite(24, 24);
+            fillSprite(s, i);
+            s.setPos(90 + i * 10, 20 + i * 10);
+        }
+        EXPECT(checkFrame(te));
+        te.getSprite(1).setVisible(false);
+        EXPECT(checkFrame(te));
+        // the hidden sprite's pixels are not drawn at all, the column looks as if the sprite did not exist
+        Renderer<Engine> r;
+        ScratchArena scratch{1024};
+        r.indexSprites(te, scratch);
+        ColorRGB hidden[96];
+        for (Coord column = te.pixelWidth() - 1; column >= 105; --column)
+            r.renderColumn(column, hidden, te);
+        te.getSprite(1).setPos(1000, 0);
+        te.getSprite(1).setVisible(true);
+        ColorRGB moved[96];
+        fullScanColumn(te, 105, moved);
+        EXPECT(std::equal(hidden, hidden + 96, moved));
+        // and it shows again once visible
+        te.getSprite(1).setPos(100, 30);
+        EXPECT(checkFrame(te));
+    }
+    memoryLeaveArena();
+}